@@ -0,0 +1,85 @@
+"""
+Plumbing shared by the benchmark scripts in this directory.
+
+Each script adds its own options to a parser and finishes it with
+`parse_args()`, which adds the `--output` results file option. Timings are
+taken with `timed()` or `best_time()`, which synchronise all processes before
+and after the timed call, and results are written by `write_results()` as
+JSON on rank 0, headed by the benchmark name, underworld version, process
+count, host and date so that runs may be compared across releases.
+"""
+import json
+import os
+import platform
+import resource
+import time
+import collections
+
+import underworld as uw
+
+
+def parse_args(parser, benchmark):
+    """
+    Adds the `--output` option, defaulting to `<benchmark>.json`, and parses
+    the command line.
+    """
+    parser.add_argument("--output", default=benchmark+".json",
+                        help="JSON results file, written by rank 0.")
+    return parser.parse_args()
+
+
+def timed(func, *args, **kwargs):
+    """
+    Returns the wall time of the collective call `func(*args, **kwargs)`.
+    """
+    uw.mpi.barrier()
+    ts = time.perf_counter()
+    func(*args, **kwargs)
+    uw.mpi.barrier()
+    return time.perf_counter() - ts
+
+
+def best_time(repeats, func, *args, **kwargs):
+    """
+    Returns the fastest wall time of `repeats` calls to `func`.
+    """
+    return min(timed(func, *args, **kwargs) for it in range(repeats))
+
+
+def resident_bytes():
+    """
+    Returns the resident memory of this process, read from /proc/self/statm
+    where available and otherwise the peak resident size.
+    """
+    try:
+        with open("/proc/self/statm") as f:
+            return int(f.read().split()[1])*os.sysconf("SC_PAGE_SIZE")
+    except (IOError, OSError, ValueError):
+        return peak_resident_bytes()
+
+
+def peak_resident_bytes():
+    """
+    Returns the peak resident memory of this process.
+    """
+    # ru_maxrss is reported in kilobytes on linux
+    return resource.getrusage(resource.RUSAGE_SELF).ru_maxrss*1024
+
+
+def write_results(filename, benchmark, fields):
+    """
+    Writes the results file on rank 0, with the standard header followed by
+    the provided (ordered) `fields`.
+    """
+    if uw.mpi.rank != 0:
+        return
+    output = collections.OrderedDict()
+    output["benchmark"] = benchmark
+    output["version"]   = uw.__version__
+    output["nprocs"]    = uw.mpi.size
+    output["host"]      = platform.node()
+    output["date"]      = time.strftime("%Y-%m-%dT%H:%M:%S")
+    output.update(fields)
+    with open(filename, "w") as f:
+        json.dump(output, f, indent=2)
+    print("Results written to {}".format(filename), flush=True)
@@ -0,0 +1,122 @@
+"""
+Asynchronous checkpoint benchmark.
+
+A Stokes model with a material swarm is stepped, with a checkpoint of the
+mesh, velocity, pressure, swarm and a swarm variable written at every step.
+Checkpoints are written synchronously, and then using an
+`underworld.utils.AsyncWriter` where the writes are posted before the next
+solve and completed after it. For the asynchronous checkpoints, the time to
+stage the data and post the writes and the time left waiting for the writes
+after the solve are recorded, and the fraction of the synchronous checkpoint
+time hidden behind the solve is reported.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 8 python3 async_checkpoint.py --res 64 --ppc 20 --outdir /scratch/ckpt --output async.json
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import os
+import tempfile
+import collections
+
+import underworld as uw
+from underworld import function as fn
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Asynchronous checkpoint benchmark.")
+    parser.add_argument("--dim", type=int, default=2, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=64,
+                        help="Element resolution per axis.")
+    parser.add_argument("--ppc", type=int, default=20,
+                        help="Particles per cell.")
+    parser.add_argument("--steps", type=int, default=5,
+                        help="Number of steps (and checkpoints) for each mode.")
+    parser.add_argument("--staging-mb", type=float, default=1024.,
+                        help="Staging memory cap per process for the asynchronous writer (MB).")
+    parser.add_argument("--outdir", default=None,
+                        help="Directory for checkpoint files (defaults to a temporary directory).")
+    return bench.parse_args(parser, "async_checkpoint")
+
+
+def main():
+    args = parse_args()
+    dim  = args.dim
+
+    mesh     = uw.mesh.FeMesh_Cartesian(elementType="Q1/dQ0", elementRes=(args.res,)*dim,
+                                        minCoord=(0.,)*dim, maxCoord=(1.,)*dim)
+    velocity = uw.mesh.MeshVariable(mesh, dim)
+    pressure = uw.mesh.MeshVariable(mesh.subMesh, 1)
+    swarm    = uw.swarm.Swarm(mesh=mesh)
+    material = swarm.add_variable("int", 1)
+    swarm.populate_using_layout(uw.swarm.layouts.PerCellSpaceFillerLayout(swarm, particlesPerCell=args.ppc))
+    coord    = fn.input()
+    material.data[:] = (coord[dim-1] > 0.5).evaluate(swarm)
+
+    velocity.data[:] = 0.
+    pressure.data[:] = 0.
+    walls  = mesh.specialSets["AllWalls_VertexSet"]
+    bcs    = uw.conditions.DirichletCondition(velocity, (walls,)*dim)
+    density = fn.branching.map(fn_key=material, mapping={0:0., 1:1.})
+    stokes = uw.systems.Stokes(velocity, pressure, fn_viscosity=1., conditions=bcs,
+                               fn_bodyforce=[0.,]*(dim-1) + [-density,])
+    solver = uw.systems.Solver(stokes)
+
+    outdir = args.outdir
+    if outdir is None:
+        outdir = tempfile.mkdtemp() if uw.mpi.rank == 0 else None
+        outdir = uw.mpi.comm.bcast(outdir, root=0)
+
+    def checkpoint(step, writer=None):
+        meshHandle  = mesh.save(os.path.join(outdir, "mesh.h5"), writer=writer)
+        velocity.save(os.path.join(outdir, "velocity-{}.h5".format(step)), meshHandle, writer=writer)
+        pressure.save(os.path.join(outdir, "pressure-{}.h5".format(step)), meshHandle, writer=writer)
+        swarmHandle = swarm.save(os.path.join(outdir, "swarm-{}.h5".format(step)), writer=writer)
+        material.save(os.path.join(outdir, "material-{}.h5".format(step)), swarmHandle=swarmHandle, writer=writer)
+
+    # synchronous checkpoints
+    sync = []
+    for step in range(args.steps):
+        result = collections.OrderedDict()
+        result["solve_time"]      = bench.timed(solver.solve)
+        result["checkpoint_time"] = bench.timed(checkpoint, step)
+        sync.append(result)
+
+    # asynchronous checkpoints, each hidden behind the following solve
+    writer = uw.utils.AsyncWriter(maxStagingBytes=int(args.staging_mb*1024*1024))
+    asynchronous = []
+    for step in range(args.steps):
+        result = collections.OrderedDict()
+        result["stage_time"] = bench.timed(checkpoint, step, writer)
+        result["solve_time"] = bench.timed(solver.solve)
+        result["wait_time"]  = bench.timed(writer.wait)
+        asynchronous.append(result)
+
+    syncTime  = sum(r["checkpoint_time"] for r in sync)/args.steps
+    stageTime = sum(r["stage_time"] for r in asynchronous)/args.steps
+    waitTime  = sum(r["wait_time"] for r in asynchronous)/args.steps
+    output = collections.OrderedDict()
+    output["dim"]       = dim
+    output["res"]       = args.res
+    output["particles"] = swarm.particleGlobalCount
+    output["outdir"]    = outdir
+    output["mean_sync_checkpoint_time"]  = syncTime
+    output["mean_async_stage_time"]      = stageTime
+    output["mean_async_wait_time"]       = waitTime
+    output["hidden_fraction"] = (syncTime - stageTime - waitTime)/syncTime if syncTime > 0 else 0.
+    output["sync"]         = sync
+    output["asynchronous"] = asynchronous
+    if uw.mpi.rank == 0:
+        print("checkpoint: sync {:.3f}s, async stage {:.3f}s + wait {:.3f}s ({:.0f}% hidden)".format(
+              syncTime, stageTime, waitTime, 100.*output["hidden_fraction"]))
+    bench.write_results(args.output, "async_checkpoint", output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,105 @@
+"""
+Checkpoint bandwidth benchmark.
+
+A velocity mesh variable and a swarm variable are saved and then loaded, both
+through the h5py path and natively, where the values are written and read
+collectively using MPI-IO directly from the nodal and particle arrays. For
+each variable and path the fastest save and load times are recorded, and the
+corresponding bandwidths (in MB/s of dataset values) are reported.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 64 python3 checkpoint_bandwidth.py --res 256 --ppc 20 --outdir /scratch/ckpt --output bandwidth.json
+
+Use `--help` for the full set of options. The dataset alignment for native
+saves may be set with the `UW_IO_ALIGNMENT` environment variable.
+"""
+import argparse
+import os
+import tempfile
+import collections
+
+import underworld as uw
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Checkpoint bandwidth benchmark.")
+    parser.add_argument("--dim", type=int, default=2, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=256,
+                        help="Element resolution per axis.")
+    parser.add_argument("--ppc", type=int, default=20,
+                        help="Particles per cell.")
+    parser.add_argument("--repeats", type=int, default=3,
+                        help="Number of saves and loads. Timings from the fastest are reported.")
+    parser.add_argument("--outdir", default=None,
+                        help="Directory for checkpoint files (defaults to a temporary directory).")
+    return bench.parse_args(parser, "checkpoint_bandwidth")
+
+
+
+def main():
+    args = parse_args()
+    dim  = args.dim
+
+    mesh     = uw.mesh.FeMesh_Cartesian(elementType="Q1", elementRes=(args.res,)*dim,
+                                        minCoord=(0.,)*dim, maxCoord=(1.,)*dim)
+    velocity = mesh.add_variable(dim)
+    velocity.data[:] = mesh.data
+    swarm    = uw.swarm.Swarm(mesh=mesh)
+    swarm.populate_using_layout(uw.swarm.layouts.PerCellSpaceFillerLayout(swarm, particlesPerCell=args.ppc))
+    svar     = swarm.add_variable("double", dim)
+    svar.data[:] = swarm.particleCoordinates.data
+
+    outdir = args.outdir
+    if outdir is None:
+        outdir = tempfile.mkdtemp() if uw.mpi.rank == 0 else None
+        outdir = uw.mpi.comm.bcast(outdir, root=0)
+    swarmHandle = swarm.save(os.path.join(outdir, "swarm.h5"))
+    # swarm variables may only be loaded onto a swarm loaded from file
+    loadSwarm = uw.swarm.Swarm(mesh=mesh)
+    loadSvar  = loadSwarm.add_variable("double", dim)
+    loadSwarm.load(swarmHandle.filename)
+
+    cases = collections.OrderedDict()
+    cases["mesh_variable"]  = (velocity, velocity, mesh.nodesGlobal*dim*8)
+    cases["swarm_variable"] = (svar, loadSvar, swarm.particleGlobalCount*dim*8)
+
+    results = []
+    for name, (var, loadVar, nbytes) in cases.items():
+        for native in (False, True):
+            filename = os.path.join(outdir, "{}-{}.h5".format(name, "native" if native else "h5py"))
+            if var is svar:
+                save = bench.best_time(args.repeats, var.save, filename, swarmHandle=swarmHandle, native=native)
+            else:
+                save = bench.best_time(args.repeats, var.save, filename, native=native)
+            load = bench.best_time(args.repeats, loadVar.load, filename, native=native)
+
+            result = collections.OrderedDict()
+            result["variable"]  = name
+            result["path"]      = "native" if native else "h5py"
+            result["bytes"]     = nbytes
+            result["save_time"] = save
+            result["load_time"] = load
+            result["save_MBps"] = nbytes/save/1.e6
+            result["load_MBps"] = nbytes/load/1.e6
+            results.append(result)
+            if uw.mpi.rank == 0:
+                print("{:15s} {:6s} save {:9.1f} MB/s  load {:9.1f} MB/s".format(
+                      name, result["path"], result["save_MBps"], result["load_MBps"]), flush=True)
+
+    output = collections.OrderedDict()
+    output["dim"]       = dim
+    output["res"]       = args.res
+    output["particles"] = swarm.particleGlobalCount
+    output["alignment"] = uw.utils._io.ALIGNMENT
+    output["outdir"]    = outdir
+    output["results"]   = results
+    bench.write_results(args.output, "checkpoint_bandwidth", output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,95 @@
+"""
+Cross section sampling benchmark.
+
+A scalar function is drawn over a cross section of a 3d mesh, sampled on a
+regular grid of the requested resolution. Each draw is set up and drawn as
+when the figure is saved, and only this (sampling the function at the grid
+points within each processor's local domain and combining the sampled values
+on the root process) is timed, the geometry is discarded after each draw
+without being written to the database. The first draw locates the samples in
+the mesh, later draws reuse them, and the number of planes held in the sample
+cache is checked to stay the same from draw to draw.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 64 python3 cross_section.py --samples 1024 --output xsection.json
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import collections
+
+import underworld as uw
+from underworld import function as fn
+import underworld.visualisation as vis
+from underworld import libUnderworld
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Cross section sampling benchmark.")
+    parser.add_argument("--samples", type=int, default=1024,
+                        help="Cross section sampling resolution per axis.")
+    parser.add_argument("--res", type=int, default=32,
+                        help="Element resolution per axis.")
+    parser.add_argument("--cross-section", dest="crossSection", default="z=0.5",
+                        help="Cross section definition.")
+    parser.add_argument("--repeats", type=int, default=3,
+                        help="Number of draws after the first. Timings from the fastest are reported.")
+    return bench.parse_args(parser, "cross_section")
+
+
+def draw(surface, store):
+    libUnderworld.gLucifer._lucCrossSection_Setup(surface._dr, store._db, None)
+    libUnderworld.gLucifer._lucScalarField_Draw(surface._dr, store._db, None)
+
+
+def main():
+    args = parse_args()
+
+    mesh  = uw.mesh.FeMesh_Cartesian(elementType="Q1", elementRes=(args.res,)*3,
+                                     minCoord=(0.,)*3, maxCoord=(1.,)*3)
+    field = uw.mesh.MeshVariable(mesh, 1)
+    field.data[:] = (fn.math.sin(10.*fn.input()[0])*fn.input()[1]).evaluate(mesh)
+
+    store   = vis.Store()
+    fig     = vis.Figure(store, name="xsection")
+    surface = vis.objects.Surface(mesh, field, crossSection=args.crossSection,
+                                  resolution=[args.samples,args.samples,1], colourBar=False)
+    fig.append(surface)
+    # generate once to set up the drawing object and database
+    fig.save()
+    # discard locations from the setup frame so the first timed draw locates samples
+    with mesh.deform_mesh():
+        mesh.data[0] += 1.e-6
+    mesh.reset()
+
+    times = []
+    for it in range(args.repeats + 1):
+        times.append(bench.timed(draw, surface, store))
+        libUnderworld.gLucifer.lucDatabase_ClearGeometry(store._db)
+
+        planes = libUnderworld.gLucifer.lucCrossSection_GetNumCachedPlanes(surface._dr)
+        if it == 0:
+            first = planes
+        elif planes != first:
+            raise RuntimeError("Sample cache changed from {} to {} planes on draw {}.".format(first, planes, it))
+    best = min(times[1:])
+
+    output = collections.OrderedDict()
+    output["res"]                = args.res
+    output["samples"]            = args.samples
+    output["cross_section"]      = args.crossSection
+    output["cached_planes"]      = first
+    output["first_draw_time"]    = times[0]
+    output["draw_time"]          = best
+    output["samples_per_second"] = args.samples*args.samples/best
+    if uw.mpi.rank == 0:
+        print("{0}x{0} cross section: first draw {1:.4f}s, cached draw {2:.4f}s".format(args.samples, times[0], best))
+    bench.write_results(args.output, "cross_section", output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,97 @@
+"""
+Visualisation database output benchmark for many drawing objects.
+
+A figure containing a number of small drawing objects (surfaces, points and
+vector arrows in turn) is written to a gLucifer database over a series of
+timesteps, so that the per-frame database overhead (statement preparation,
+transactions and inserts) may be measured independently of the cost of
+sampling large geometry. For every timestep the frame output time is
+recorded, and the total, mean and maximum frame times along with the final
+database size are reported.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 4 python3 database_output.py --objects 20 --steps 100 --output db.json
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import os
+import tempfile
+import collections
+
+import numpy as np
+import underworld as uw
+from underworld import function as fn
+import underworld.visualisation as vis
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Visualisation database output benchmark.")
+    parser.add_argument("--objects", type=int, default=20,
+                        help="Number of drawing objects in the figure.")
+    parser.add_argument("--steps", type=int, default=100,
+                        help="Number of timesteps written.")
+    parser.add_argument("--res", type=int, default=16,
+                        help="Element resolution per axis.")
+    parser.add_argument("--no-compress", dest="compress", action="store_false",
+                        help="Disable database compression.")
+    parser.add_argument("--split", action="store_true",
+                        help="Write a separate database file for each timestep.")
+    return bench.parse_args(parser, "database_output")
+
+
+def main():
+    args = parse_args()
+
+    mesh  = uw.mesh.FeMesh_Cartesian(elementType="Q1", elementRes=(args.res,args.res),
+                                     minCoord=(0.,0.), maxCoord=(1.,1.))
+    field = uw.mesh.MeshVariable(mesh, 1)
+    vel   = uw.mesh.MeshVariable(mesh, 2)
+    swarm = uw.swarm.Swarm(mesh=mesh)
+    swarm.populate_using_layout(uw.swarm.layouts.PerCellSpaceFillerLayout(swarm, particlesPerCell=4))
+    coord = fn.input()
+
+    tmpdir = tempfile.mkdtemp() if uw.mpi.rank == 0 else None
+    tmpdir = uw.mpi.comm.bcast(tmpdir, root=0)
+    store  = vis.Store(os.path.join(tmpdir, "objects"), split=args.split, compress=args.compress)
+    fig    = vis.Figure(store, name="objects")
+    for i in range(args.objects):
+        kind = i % 3
+        if kind == 0:
+            fig.append(vis.objects.Surface(mesh, field, colourBar=False))
+        elif kind == 1:
+            fig.append(vis.objects.Points(swarm, coord[0], pointSize=2, colourBar=False))
+        else:
+            fig.append(vis.objects.VectorArrows(mesh, vel))
+
+    frames = []
+    for step in range(args.steps):
+        field.data[:,0] = np.sin(mesh.data[:,0]*(step+1))
+        vel.data[:]     = np.cos(mesh.data*(step+1))
+        store.step = step
+        frames.append(bench.timed(fig.save))
+
+    if uw.mpi.rank == 0:
+        output = collections.OrderedDict()
+        output["objects"]         = args.objects
+        output["steps"]           = args.steps
+        output["res"]             = args.res
+        output["compress"]        = args.compress
+        output["split"]           = args.split
+        output["total_time"]      = sum(frames)
+        output["mean_frame_time"] = sum(frames)/len(frames)
+        output["max_frame_time"]  = max(frames)
+        output["db_bytes"]        = os.path.getsize(store.filename)
+        output["frame_times"]     = frames
+        print("{} objects, {} steps: total {:.3f}s, mean frame {:.4f}s".format(
+              args.objects, args.steps, output["total_time"], output["mean_frame_time"]))
+        bench.write_results(args.output, "database_output", output)
+
+
+
+if __name__ == "__main__":
+    main()
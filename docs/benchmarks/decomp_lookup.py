@@ -0,0 +1,118 @@
+"""
+Decomposition global to local lookup benchmark.
+
+A decomposition is set up on each process with a given number of locals, and
+the throughput of translating every local's global index back to its local
+index with the batched `Decomp_GlobalsToLocals` is recorded, for the globals
+both in local order and shuffled, along with the memory held by the global to
+local map. The locals are laid out in one of several ways:
+
+    structured  -- the block of a structured grid decomposed along its fastest
+                   axis, so the locals form runs of consecutive globals.
+    shadowed    -- as for structured, with the last tenth of the locals
+                   shuffled, as the shadows appended to a block are.
+    scattered   -- a random selection of globals, which are all hashed, as the
+                   whole map was before runs were detected.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 4 python3 decomp_lookup.py --res 128 --output decomp.json
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import collections
+
+import numpy as np
+import underworld as uw
+from underworld import libUnderworld
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Decomposition global to local lookup benchmark.")
+    parser.add_argument("--res", type=int, default=128,
+                        help="Resolution per axis of each process's block, which has res**3 locals.")
+    parser.add_argument("--repeats", type=int, default=3,
+                        help="Number of lookups. Timings from the fastest are reported.")
+    return bench.parse_args(parser, "decomp_lookup")
+
+
+def structured_locals(res, rank, nprocs):
+    """
+    Returns the globals of this rank's block of a (nprocs*res, res, res) grid, in
+    local order with the first axis fastest.
+    """
+    i, j, k = np.meshgrid(np.arange(rank*res, (rank + 1)*res), np.arange(res), np.arange(res),
+                          indexing="ij")
+    return (i + nprocs*res*(j + res*k)).flatten(order="F").astype(np.int32)
+
+
+def layouts(res, rank, nprocs, rng):
+    nlocals  = res**3
+    nglobals = nlocals*nprocs
+    cases = collections.OrderedDict()
+
+    cases["structured"] = structured_locals(res, rank, nprocs)
+
+    nshadows = nlocals//10
+    owned    = cases["structured"]
+    cases["shadowed"] = np.concatenate((owned[:nlocals - nshadows],
+                                        rng.permutation(owned[nlocals - nshadows:])))
+
+    # the same random permutation of all globals on every rank, split between them
+    perm = np.random.RandomState(0).permutation(nglobals).astype(np.int32)
+    cases["scattered"] = perm[rank*nlocals:(rank + 1)*nlocals]
+    return cases
+
+
+def best_lookup(decomp, globals_, repeats):
+    # the lookup is made in place, so each repeat starts from a fresh copy
+    walls = []
+    for it in range(repeats):
+        inds = globals_.copy()
+        walls.append(bench.timed(libUnderworld.StgDomain.Decomp_GlobalsToLocals, decomp, inds))
+    return min(walls)
+
+
+def main():
+    args = parse_args()
+    rng  = np.random.RandomState(uw.mpi.rank)
+
+    results = []
+    for name, locals_ in layouts(args.res, uw.mpi.rank, uw.mpi.size, rng).items():
+        decomp = libUnderworld.StgDomain.Decomp_New()
+        setup  = bench.timed(libUnderworld.StgDomain.Decomp_SetLocals, decomp, locals_)
+
+
+        ordered  = best_lookup(decomp, locals_, args.repeats)
+        shuffled = best_lookup(decomp, rng.permutation(locals_), args.repeats)
+        memory   = uw.mpi.comm.allreduce(libUnderworld.StgDomain.Decomp_GetInverseMemory(decomp))
+        nlookups = len(locals_)*uw.mpi.size
+
+        result = collections.OrderedDict()
+        result["layout"] = name
+        result["locals_per_process"] = len(locals_)
+        result["runs_per_process"] = decomp.nRuns
+        result["setup_time"] = setup
+        result["ordered_lookups_per_second"] = nlookups/ordered
+        result["shuffled_lookups_per_second"] = nlookups/shuffled
+        result["map_bytes"] = memory
+        result["map_bytes_per_local"] = memory/nlookups
+        results.append(result)
+        if uw.mpi.rank == 0:
+            print("{:10s} {:9d} runs, ordered {:.3e}/s, shuffled {:.3e}/s, {:.2f} bytes/local".format(
+                  name, decomp.nRuns, result["ordered_lookups_per_second"],
+                  result["shuffled_lookups_per_second"], result["map_bytes_per_local"]), flush=True)
+        libUnderworld.StGermain.Stg_Class_Delete(decomp)
+
+    output = collections.OrderedDict()
+    output["res"]     = args.res
+    output["results"] = results
+    bench.write_results(args.output, "decomp_lookup", output)
+
+
+if __name__ == "__main__":
+    main()
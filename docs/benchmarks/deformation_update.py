@@ -0,0 +1,95 @@
+"""
+Mesh deformation update benchmark.
+
+The mesh is repeatedly deformed, moving either every vertex or only a small
+patch of vertices, and the time for each deformation (including the update of
+the mesh metrics and search structures) is recorded. The minimum separation
+is no longer computed by the update itself, so the time for the first query
+of it after each deformation (as made by a timestep calculation) is recorded
+separately.
+
+Each update makes a single collective reduction, for the global coordinate
+range. To count the collectives made, run under an MPI profiling tool (eg.
+mpiP) and compare the MPI_Allreduce counts against the number of updates.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 4 python3 deformation_update.py --res 256 --updates 20 --output deform.json
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import collections
+
+import numpy as np
+import underworld as uw
+from underworld import libUnderworld
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Mesh deformation update benchmark.")
+    parser.add_argument("--dim", type=int, default=2, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=256,
+                        help="Element resolution per axis.")
+    parser.add_argument("--updates", type=int, default=20,
+                        help="Number of deformations for each case.")
+    return bench.parse_args(parser, "deformation_update")
+
+
+def deform(mesh, vertices, amplitude):
+    with mesh.deform_mesh():
+        mesh.data[vertices,0] += amplitude*np.sin(np.pi*mesh.data[vertices,1])
+
+
+def min_separation(mesh):
+    sep = libUnderworld.c_arrays.DoubleArray(1)
+    libUnderworld.StgDomain.Mesh_GetMinimumSeparation(mesh._cself, sep.cast(), None)
+    return sep[0]
+
+
+def main():
+    args = parse_args()
+    dim  = args.dim
+
+    mesh = uw.mesh.FeMesh_Cartesian(elementType="Q1/dQ0", elementRes=(args.res,)*dim,
+                                    minCoord=(0.,)*dim, maxCoord=(1.,)*dim)
+    # the first deformation sets up the incremental update state
+    deform(mesh, slice(None), 1.e-3/args.res)
+
+    cases = collections.OrderedDict()
+    cases["all_vertices"] = slice(None)
+    cases["patch"]        = np.arange(min(16, mesh.nodesLocal))
+
+    results = []
+    for name, vertices in cases.items():
+        updates = []
+        queries = []
+        for it in range(args.updates):
+            amplitude = 1.e-3/args.res*(-1)**it
+            updates.append(bench.timed(deform, mesh, vertices, amplitude))
+            queries.append(bench.timed(min_separation, mesh))
+        result = collections.OrderedDict()
+        result["case"] = name
+        result["mean_update_time"] = sum(updates)/len(updates)
+        result["mean_separation_query_time"] = sum(queries)/len(queries)
+        result["update_times"] = updates
+        result["separation_query_times"] = queries
+        results.append(result)
+        if uw.mpi.rank == 0:
+            print("{:13s} update {:.4f}s, separation query {:.4f}s".format(
+                  name, result["mean_update_time"], result["mean_separation_query_time"]), flush=True)
+
+    output = collections.OrderedDict()
+    output["dim"]      = dim
+    output["res"]      = args.res
+    output["elements"] = mesh.elementsGlobal
+    output["results"]  = results
+    bench.write_results(args.output, "deformation_update", output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,106 @@
+"""
+Equation numbering setup benchmark.
+
+Equation numbers (and the location matrix) are generated for a vector mesh
+variable, as an equation system does when it is set up, and the fastest time
+of each is recorded. The cases are:
+
+    free        -- no boundary conditions.
+    dirichlet   -- the normal velocity fixed on every wall, with the
+                   constrained dofs removed from the numbering.
+    periodic    -- as for dirichlet, but periodic in the first axis. Periodic
+                   meshes still go through the general (PETSc based) path, so
+                   this case gives the baseline the others are compared to.
+
+Setup time is the quantity of interest when scaling out, so run at several
+process counts, eg:
+
+    for np in 1 64 512; do
+        mpirun -np $np python3 eqnum_setup.py --dim 3 --res 128 --output eqnum_$np.json
+    done
+
+Results are written by rank 0 as JSON. Use `--help` for the full set of
+options.
+"""
+import argparse
+import collections
+
+import underworld as uw
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Equation numbering setup benchmark.")
+    parser.add_argument("--dim", type=int, default=3, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=64,
+                        help="Element resolution per axis.")
+    parser.add_argument("--element", default="Q1", choices=["Q1","Q2"],
+                        help="Element type of the mesh.")
+    parser.add_argument("--repeats", type=int, default=3,
+                        help="Number of setups per case. Timings from the fastest are reported.")
+    return bench.parse_args(parser, "eqnum_setup")
+
+
+def make_case(name, args):
+    dim  = args.dim
+    mesh = uw.mesh.FeMesh_Cartesian(elementType=args.element, elementRes=(args.res,)*dim,
+                                    minCoord=(0.,)*dim, maxCoord=(1.,)*dim,
+                                    periodic=[name == "periodic"] + [False]*(dim - 1))
+    velocity = mesh.add_variable(dim)
+    cond     = None
+    if name != "free":
+        walls = [ mesh.specialSets["MinI_VertexSet"] + mesh.specialSets["MaxI_VertexSet"],
+                  mesh.specialSets["MinJ_VertexSet"] + mesh.specialSets["MaxJ_VertexSet"] ]
+        if dim == 3:
+            walls.append(mesh.specialSets["MinK_VertexSet"] + mesh.specialSets["MaxK_VertexSet"])
+        if name == "periodic":
+            walls[0] = None
+        cond = uw.conditions.DirichletCondition(velocity, indexSetsPerDof=walls)
+        # attached as an equation system does before numbering its fields
+        uw.libUnderworld.StgFEM.FeVariable_SetBC(velocity._cself, cond._cself)
+    return mesh, velocity, cond
+
+
+def best_setup(velocity, repeats):
+    # each numbering is kept until after its timing, so its teardown is not timed
+    eqnums = []
+    def setup():
+        eqnums.append(uw.systems.sle.EqNumber(velocity))
+
+    walls = []
+    for it in range(repeats):
+        walls.append(bench.timed(setup))
+        neqs = eqnums.pop()._cself.globalSumUnconstrainedDofs
+    return min(walls), neqs
+
+
+
+def main():
+    args = parse_args()
+
+    results = []
+    for name in ("free", "dirichlet", "periodic"):
+        mesh, velocity, cond = make_case(name, args)
+        setup, neqs = best_setup(velocity, args.repeats)
+
+        result = collections.OrderedDict()
+        result["case"] = name
+        result["equations"] = neqs
+        result["setup_time"] = setup
+        result["equations_per_second"] = neqs/setup
+        results.append(result)
+        if uw.mpi.rank == 0:
+            print("{:10s} {:10d} equations, setup {:.4f}s".format(name, neqs, setup), flush=True)
+
+    output = collections.OrderedDict()
+    output["dim"]     = args.dim
+    output["res"]     = args.res
+    output["element"] = args.element
+    output["results"] = results
+    bench.write_results(args.output, "eqnum_setup", output)
+
+
+if __name__ == "__main__":
+    main()
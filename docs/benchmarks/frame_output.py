@@ -0,0 +1,106 @@
+"""
+Visualisation frame output benchmark for swarm points.
+
+A swarm is populated with increasing numbers of particles and a figure
+containing a coloured points drawing object is written to a gLucifer
+database, one frame per repeat. For each particle count the time taken to
+output a frame (sampling, gathering to the root process, compression and
+database insert), the memory high-water mark of the root process and the size
+of the resulting database are recorded. Pass `--no-compress` to measure output
+with database compression disabled, and `--partitions` to write geometry
+partitions from multiple processes.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 4 python3 frame_output.py --particles 1e5 1e6 1e7 --output frames.json
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import os
+import tempfile
+import collections
+
+import underworld as uw
+from underworld import function as fn
+import underworld.visualisation as vis
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Visualisation frame output benchmark.")
+    parser.add_argument("--particles", nargs="+", type=float, default=[1e4,1e5,1e6],
+                        help="Approximate global particle counts to benchmark.")
+    parser.add_argument("--dim", type=int, default=2, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=64,
+                        help="Element resolution per axis (particle counts are rounded to whole particles per cell).")
+    parser.add_argument("--repeats", type=int, default=3,
+                        help="Number of frames written per particle count. Timings from the fastest frame are reported.")
+    parser.add_argument("--no-compress", dest="compress", action="store_false",
+                        help="Disable database compression.")
+    parser.add_argument("--partitions", type=int, default=0,
+                        help="Number of geometry partitions written in parallel (0 gathers all geometry to root).")
+    return bench.parse_args(parser, "frame_output")
+
+
+def run_case(mesh, particles, repeats, compress, partitions, tmpdir):
+    """
+    Populates a swarm and writes frames for a single particle count.
+    """
+    ppc   = max(1, int(round(particles/mesh.elementsGlobal)))
+    swarm = uw.swarm.Swarm(mesh=mesh)
+    swarm.populate_using_layout(uw.swarm.layouts.PerCellSpaceFillerLayout(swarm, particlesPerCell=ppc))
+    svar  = swarm.add_variable("double", 1)
+    svar.data[:] = fn.math.sin(10.*fn.input()[0]).evaluate(swarm)
+
+    filename = os.path.join(tmpdir, "frames_{}".format(ppc))
+    store = vis.Store(filename, compress=compress, partitions=partitions)
+    fig   = vis.Figure(store, name="points")
+    fig.append(vis.objects.Points(swarm, svar, pointSize=2, colourBar=False))
+
+    frames = []
+    for it in range(repeats):
+        store.step = it
+        frames.append(bench.timed(fig.save))
+
+    result = collections.OrderedDict()
+    result["particles"]         = swarm.particleGlobalCount
+    result["particles_per_cell"] = ppc
+    result["frame_time"]        = min(frames)
+    if uw.mpi.rank == 0:
+        result["db_bytes_per_frame"] = os.path.getsize(store.filename) / float(repeats)
+        result["root_mem_hwm_mb"] = bench.peak_resident_bytes() / 1024.**2
+
+    return result
+
+
+def main():
+    args = parse_args()
+    dim  = args.dim
+
+    mesh = uw.mesh.FeMesh_Cartesian(elementType="Q1", elementRes=(args.res,)*dim,
+                                    minCoord=(0.,)*dim, maxCoord=(1.,)*dim)
+    tmpdir = tempfile.mkdtemp() if uw.mpi.rank == 0 else None
+    tmpdir = uw.mpi.comm.bcast(tmpdir, root=0)
+
+    results = []
+    for particles in args.particles:
+        result = run_case(mesh, particles, args.repeats, args.compress, args.partitions, tmpdir)
+        results.append(result)
+        if uw.mpi.rank == 0:
+            print("{:12d} particles  frame {:.4f}s".format(result["particles"], result["frame_time"]), flush=True)
+
+    output = collections.OrderedDict()
+    output["dim"]        = dim
+    output["res"]        = args.res
+    output["compress"]   = args.compress
+    output["partitions"] = args.partitions
+    output["results"]    = results
+    bench.write_results(args.output, "frame_output", output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,109 @@
+"""
+Implicit element to vertex incidence benchmark.
+
+Cartesian meshes answer element to vertex incidence from their grids, keeping
+only a map of the domain vertices rather than a list per element. The memory
+held by the incidence is recorded for the implicit form and again after the
+explicit lists are built with `Mesh_MaterialiseIncidence`, summed over all
+processes, along with the growth in resident memory that building them causes.
+Stokes assembly is timed with each form, as the time spent in `solve()` outside
+the linear solver, to confirm queries are no slower.
+
+The meshes of interest are large, so run in parallel, eg:
+
+    mpirun -np 64 python3 implicit_topology.py --dim 3 --res 512 --element-type Q1/dQ0 --output q1.json
+    mpirun -np 64 python3 implicit_topology.py --dim 3 --res 256 --element-type Q2/dPc1 --output q2.json
+
+Results are written by rank 0 as JSON. Use `--help` for the full set of
+options. Resident memory is read from /proc/self/statm where available, and
+otherwise from the peak resident size.
+"""
+import argparse
+import collections
+
+import underworld as uw
+from underworld import function as fn
+from underworld import libUnderworld
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Implicit element to vertex incidence benchmark.")
+    parser.add_argument("--dim", type=int, default=3, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=32,
+                        help="Element resolution per axis.")
+    parser.add_argument("--element-type", default="Q1/dQ0",
+                        help="Mesh element type, eg 'Q1/dQ0' or 'Q2/dPc1'.")
+    parser.add_argument("--repeats", type=int, default=3,
+                        help="Number of solves per form. Timings from the fastest solve are reported.")
+    return bench.parse_args(parser, "implicit_topology")
+
+
+def incidence_bytes(mesh):
+    nbytes = libUnderworld.StgDomain.Mesh_GetIncidenceMemory(mesh._cself, mesh.dim, 0)
+    return uw.mpi.comm.allreduce(nbytes)
+
+
+def best_assembly(solver, repeats):
+    # the time outside the linear solver is the assembly time
+    walls = []
+    for it in range(repeats):
+        wall = bench.timed(solver.solve, nonLinearIterate=False)
+        walls.append(wall - solver.get_stats().total_time)
+    return min(walls)
+
+
+def main():
+    args = parse_args()
+    dim  = args.dim
+
+    mesh  = uw.mesh.FeMesh_Cartesian(elementType=args.element_type, elementRes=(args.res,)*dim,
+                                     minCoord=(0.,)*dim, maxCoord=(1.,)*dim)
+    vel   = uw.mesh.MeshVariable(mesh, dim)
+    press = uw.mesh.MeshVariable(mesh.subMesh, 1)
+    vel.data[:]   = (0.,)*dim
+    press.data[:] = 0.
+
+    coord    = fn.input()
+    walls    = mesh.specialSets["AllWalls_VertexSet"]
+    bcs      = uw.conditions.DirichletCondition(vel, (walls,)*dim)
+    buoyancy = [0.,]*(dim-1) + [fn.math.sin(3.14159*coord[0])*coord[dim-1],]
+    stokes   = uw.systems.Stokes(vel, press, fn_viscosity=1., fn_bodyforce=buoyancy, conditions=bcs)
+    solver   = uw.systems.Solver(stokes)
+
+    results = collections.OrderedDict()
+    results["implicit"] = collections.OrderedDict()
+    results["implicit"]["incidence_bytes"] = incidence_bytes(mesh)
+    results["implicit"]["assembly_time"]   = best_assembly(solver, args.repeats)
+
+    uw.mpi.barrier()
+    before = bench.resident_bytes()
+    libUnderworld.StgDomain.Mesh_MaterialiseIncidence(mesh._cself, dim, 0)
+    uw.mpi.barrier()
+    grown = uw.mpi.comm.allreduce(bench.resident_bytes() - before)
+
+    results["explicit"] = collections.OrderedDict()
+    results["explicit"]["incidence_bytes"] = incidence_bytes(mesh)
+    results["explicit"]["resident_growth_bytes"] = grown
+    results["explicit"]["assembly_time"]   = best_assembly(solver, args.repeats)
+
+    output = collections.OrderedDict()
+    output["dim"]            = dim
+    output["res"]            = args.res
+    output["element_type"]   = args.element_type
+    output["elements"]       = mesh.elementsGlobal
+    output["results"]        = results
+    output["memory_ratio"]   = float(results["explicit"]["incidence_bytes"])/results["implicit"]["incidence_bytes"]
+    output["assembly_ratio"] = results["implicit"]["assembly_time"]/results["explicit"]["assembly_time"]
+    if uw.mpi.rank == 0:
+        for name, result in results.items():
+            print("{:8s} incidence {:.3e} bytes ({:.2f}/element), assembly {:.4f}s".format(
+                  name, result["incidence_bytes"], float(result["incidence_bytes"])/mesh.elementsGlobal,
+                  result["assembly_time"]))
+    bench.write_results(args.output, "implicit_topology", output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,68 @@
+"""
+Mesh build benchmark.
+
+A Cartesian mesh is built at the requested resolution, and the wall time of
+the build and the growth in resident memory (summed over all processes) are
+recorded, along with the memory per element. Both the mesh and its submesh
+(for mixed element types such as Q1/dQ0) are included. Run the same script
+against an earlier revision to compare.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 8 python3 mesh_build.py --dim 3 --res 128 --output build.json
+
+Use `--help` for the full set of options. Resident memory is read from
+/proc/self/statm where available, and otherwise from the peak resident size.
+"""
+import argparse
+import collections
+
+import underworld as uw
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Mesh build benchmark.")
+    parser.add_argument("--dim", type=int, default=3, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=128,
+                        help="Element resolution per axis.")
+    parser.add_argument("--elementType", default="Q1/dQ0",
+                        help="Mesh element type.")
+    return bench.parse_args(parser, "mesh_build")
+
+
+def main():
+    args = parse_args()
+    dim  = args.dim
+
+    meshes = []
+    def build_mesh():
+        meshes.append(uw.mesh.FeMesh_Cartesian(elementType=args.elementType, elementRes=(args.res,)*dim,
+                                               minCoord=(0.,)*dim, maxCoord=(1.,)*dim))
+
+    uw.mpi.barrier()
+    before = bench.resident_bytes()
+    build  = bench.timed(build_mesh)
+    mesh   = meshes[0]
+    grown  = uw.mpi.comm.allreduce(bench.resident_bytes() - before)
+
+
+    output = collections.OrderedDict()
+    output["dim"]               = dim
+    output["res"]               = args.res
+    output["element_type"]      = args.elementType
+    output["elements"]          = mesh.elementsGlobal
+    output["build_time"]        = build
+    output["memory_bytes"]      = grown
+    output["bytes_per_element"] = float(grown)/mesh.elementsGlobal
+    if uw.mpi.rank == 0:
+        print("{} elements: build {:.3f}s, {:.1f} bytes/element".format(
+              mesh.elementsGlobal, build, output["bytes_per_element"]))
+    bench.write_results(args.output, "mesh_build", output)
+
+
+if __name__ == "__main__":
+    main()
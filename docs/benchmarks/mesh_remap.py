@@ -0,0 +1,132 @@
+"""
+Mesh remapping benchmark.
+
+The top surface of a Cartesian mesh is deformed sinusoidally, with the
+vertices below moved proportionally to their height, and a set of mesh
+variables is carried onto the deformed mesh by `FeMesh.remap`. For comparison
+the same remap is made by evaluating each variable at the new vertex positions
+before deforming the mesh. The fastest time of each is recorded, along with
+the conservation error of the remap, taken as the relative change in the
+integral of each variable over the mesh.
+
+Each remap starts from the undeformed mesh, so every repeat does the same
+work.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 4 python3 mesh_remap.py --res 256 --variables 4 --output remap.json
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import collections
+
+import numpy as np
+import underworld as uw
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Mesh remapping benchmark.")
+    parser.add_argument("--dim", type=int, default=2, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=256,
+                        help="Element resolution per axis.")
+    parser.add_argument("--variables", type=int, default=4,
+                        help="Number of scalar mesh variables to remap.")
+    parser.add_argument("--amplitude", type=float, default=0.05,
+                        help="Amplitude of the surface deformation.")
+    parser.add_argument("--repeats", type=int, default=3,
+                        help="Number of remaps. Timings from the fastest are reported.")
+    return bench.parse_args(parser, "mesh_remap")
+
+
+def deformed_vertices(mesh, amplitude):
+    """
+    Returns the vertices with the top surface lowered by a sinusoid, so every
+    new position lies within the current mesh.
+    """
+    dim      = mesh.dim
+    vertices = mesh.data.copy()
+    surface  = 1. - 0.5*amplitude*(1. - np.prod(np.cos(2.*np.pi*vertices[:,:dim-1]), axis=1))
+    vertices[:,dim-1] *= surface
+    return vertices
+
+
+def initial_values(mesh, var_i):
+    coords = mesh.data
+    return np.sin((var_i + 1)*np.pi*coords[:,0])*np.cos(np.pi*coords[:,-1]) + var_i
+
+
+def remap_native(mesh, variables, vertices):
+    mesh.remap(vertices, variables)
+
+
+def remap_evaluate(mesh, variables, vertices):
+    values = [ var.evaluate(vertices) for var in variables ]
+    with mesh.deform_mesh():
+        mesh.data[:] = vertices
+    for var, value in zip(variables, values):
+        var.data[:] = value
+
+
+def main():
+    args = parse_args()
+    dim  = args.dim
+
+    mesh = uw.mesh.FeMesh_Cartesian(elementType="Q1", elementRes=(args.res,)*dim,
+                                    minCoord=(0.,)*dim, maxCoord=(1.,)*dim)
+    variables = [ mesh.add_variable(1) for var_i in range(args.variables) ]
+    original  = mesh.data.copy()
+    vertices  = deformed_vertices(mesh, args.amplitude)
+
+    def reset():
+        with mesh.deform_mesh(isRegular=True):
+            mesh.data[:] = original
+        for var_i, var in enumerate(variables):
+            var.data[:,0] = initial_values(mesh, var_i)
+
+    reset()
+    # a conservative remap would keep the integrals over the undeformed mesh
+    before = [ mesh.integrate(var)[0] for var in variables ]
+
+    results = collections.OrderedDict()
+    errors  = collections.OrderedDict()
+    for name, func in (("native", remap_native), ("evaluate", remap_evaluate)):
+        walls = []
+        for it in range(args.repeats):
+            reset()
+            walls.append(bench.timed(func, mesh, variables, vertices))
+        results[name] = min(walls)
+
+
+        # the error is also measured against the initial field sampled on the deformed mesh
+        after = [ mesh.integrate(var)[0] for var in variables ]
+        for var_i, var in enumerate(variables):
+            var.data[:,0] = initial_values(mesh, var_i)
+        reference = [ mesh.integrate(var)[0] for var in variables ]
+        errors[name] = collections.OrderedDict()
+        errors[name]["integral_change"] = max( abs(a - b)/abs(b) for a, b in zip(after, before) )
+        errors[name]["integral_error"]  = max( abs(a - r)/abs(r) for a, r in zip(after, reference) )
+
+    output = collections.OrderedDict()
+    output["dim"]       = dim
+    output["res"]       = args.res
+    output["elements"]  = mesh.elementsGlobal
+    output["variables"] = args.variables
+    output["amplitude"] = args.amplitude
+    for name, wall in results.items():
+        output[name + "_remap_time"] = wall
+        output[name + "_conservation"] = errors[name]
+    output["speedup"] = results["evaluate"]/results["native"]
+    if uw.mpi.rank == 0:
+        for name in results:
+            print("{:8s} remap {:.4f}s, integral change {:.3e}, error {:.3e}".format(
+                  name, results[name], errors[name]["integral_change"], errors[name]["integral_error"]))
+    bench.write_results(args.output, "mesh_remap", output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,89 @@
+"""
+Mesh construction weak scaling benchmark.
+
+A Cartesian mesh is built with a fixed number of elements per process, the
+global resolution being the per process resolution multiplied by a balanced
+decomposition of the process count. The fastest of a number of builds is
+recorded, so a weak scaling curve is obtained by running the script over a
+range of process counts and collecting the results, where ideally the build
+time stays flat as the process count grows.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    for np in 1 8 64 512; do
+        mpirun -np $np python3 mesh_weak_scaling.py --dim 3 --res 32 --output weak-$np.json
+    done
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import collections
+
+import underworld as uw
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Mesh construction weak scaling benchmark.")
+    parser.add_argument("--dim", type=int, default=3, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=32,
+                        help="Element resolution per axis on each process.")
+    parser.add_argument("--elementType", default="Q1/dQ0",
+                        help="Mesh element type.")
+    parser.add_argument("--repeats", type=int, default=3,
+                        help="Number of builds. Timings from the fastest build are reported.")
+    return bench.parse_args(parser, "mesh_weak_scaling")
+
+
+def decompose(nprocs, dim):
+    """
+    Returns the most balanced split of nprocs into dim factors.
+    """
+    best = None
+    def recurse(remaining, factors):
+        nonlocal best
+        if len(factors) == dim - 1:
+            split = sorted(factors + [remaining,])
+            if (best is None) or (split[-1]/split[0] < best[-1]/best[0]):
+                best = split
+            return
+        for factor in range(1, remaining + 1):
+            if remaining % factor == 0:
+                recurse(remaining//factor, factors + [factor,])
+    recurse(nprocs, [])
+    return best
+
+
+def main():
+    args = parse_args()
+    dim  = args.dim
+    res  = tuple(args.res*factor for factor in decompose(uw.mpi.size, dim))
+
+    elements = []
+    def build_mesh():
+        mesh = uw.mesh.FeMesh_Cartesian(elementType=args.elementType, elementRes=res,
+                                        minCoord=(0.,)*dim, maxCoord=(1.,)*dim)
+        elements[:] = [mesh.elementsGlobal,]
+
+    times    = [bench.timed(build_mesh) for it in range(args.repeats)]
+    elements = elements[0]
+
+
+    output = collections.OrderedDict()
+    output["dim"]               = dim
+    output["res"]               = res
+    output["element_type"]      = args.elementType
+    output["elements"]          = elements
+    output["elements_per_proc"] = elements//uw.mpi.size
+    output["build_time"]        = min(times)
+    output["build_times"]       = times
+    if uw.mpi.rank == 0:
+        print("{} procs, {} elements: build {:.3f}s".format(uw.mpi.size, elements, min(times)))
+    bench.write_results(args.output, "mesh_weak_scaling", output)
+
+
+if __name__ == "__main__":
+    main()
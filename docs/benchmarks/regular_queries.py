@@ -0,0 +1,123 @@
+"""
+Regular mesh query benchmark.
+
+Random points within the local domain of an undeformed Cartesian mesh are
+passed to the mesh's nearest vertex, point search and element search queries,
+first with the regular mesh algorithms, which compute the answer directly from
+the point coordinates, and then with the generic mesh algorithms, which search
+the spatial index and vertex neighbours, so the query rates of the two may be
+compared. The queries are made one point at a time from python, so the time of
+an empty call is measured too and subtracted to give the time of each query.
+Evaluating a mesh variable at the points, which locates them with the element
+search in bulk, is timed for comparison.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 4 python3 regular_queries.py --res 1000 --queries 100000 --output queries.json
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import collections
+
+import numpy as np
+import underworld as uw
+from underworld import libUnderworld
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Regular mesh query benchmark.")
+    parser.add_argument("--dim", type=int, default=2, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=1000,
+                        help="Element resolution per axis.")
+    parser.add_argument("--queries", type=int, default=100000,
+                        help="Number of random query points per process.")
+    parser.add_argument("--repeats", type=int, default=3,
+                        help="Number of passes over the points. Timings from the fastest are reported.")
+    return bench.parse_args(parser, "regular_queries")
+
+
+def set_algorithms(mesh, algorithms):
+    """
+    Switches the mesh algorithms without moving the mesh, updating them for the queries.
+    """
+    libUnderworld.StgDomain.Mesh_SetAlgorithms(mesh._cself, algorithms)
+    libUnderworld.StgDomain.Mesh_DeformationUpdate(mesh._cself)
+
+
+def query_all(query, mesh, points, *args):
+    for point in points:
+        query(mesh._cself, point, *args)
+
+
+def empty_call(mesh, point):
+    libUnderworld.StgDomain.Mesh_GetDimSize(mesh)
+
+
+def main():
+    args = parse_args()
+    dim  = args.dim
+
+    mesh  = uw.mesh.FeMesh_Cartesian(elementType="Q1", elementRes=(args.res,)*dim,
+                                     minCoord=(0.,)*dim, maxCoord=(1.,)*dim)
+    field = mesh.add_variable(1)
+    field.data[:,0] = mesh.data[:,0]
+
+    rng    = np.random.RandomState(uw.mpi.rank)
+    lo     = mesh.data[:mesh.nodesLocal].min(axis=0)
+    hi     = mesh.data[:mesh.nodesLocal].max(axis=0)
+    points = lo + (hi - lo)*rng.random_sample((args.queries, dim))
+
+    # the queries take C arrays, so copy each point to one up front
+    arrays = []
+    for point in points:
+        array = libUnderworld.c_arrays.DoubleArray(dim)
+        for d in range(dim):
+            array[d] = point[d]
+        arrays.append(array)
+    cpoints = [ array.cast() for array in arrays ]
+    topoDim = libUnderworld.c_arrays.UnsignedArray(1)
+    index   = libUnderworld.c_arrays.UnsignedArray(1)
+
+    queries = collections.OrderedDict()
+    queries["nearest_vertex"]  = (libUnderworld.StgDomain.Mesh_NearestVertex,)
+    queries["search"]          = (libUnderworld.StgDomain.Mesh_Search, topoDim.cast(), index.cast())
+    queries["search_elements"] = (libUnderworld.StgDomain.Mesh_SearchElements, index.cast())
+
+    overhead = bench.best_time(args.repeats, query_all, empty_call, mesh, cpoints)
+
+    results = collections.OrderedDict()
+    for name, algorithms in (("regular",  libUnderworld.StgDomain.Mesh_RegularAlgorithms_New("", None)),
+                             ("generic", None)):
+        set_algorithms(mesh, algorithms)
+        results[name] = collections.OrderedDict()
+        for query, qargs in queries.items():
+            wall = bench.best_time(args.repeats, query_all, qargs[0], mesh, cpoints, *qargs[1:])
+            results[name][query + "_time"] = max(wall - overhead, 0.)/args.queries
+        wall = bench.best_time(args.repeats, field.evaluate, points)
+        results[name]["evaluate_time"] = wall/args.queries
+    set_algorithms(mesh, libUnderworld.StgDomain.Mesh_RegularAlgorithms_New("", None))
+
+    output = collections.OrderedDict()
+    output["dim"]                 = dim
+    output["res"]                 = args.res
+    output["elements"]            = mesh.elementsGlobal
+    output["queries_per_process"] = args.queries
+    output["call_overhead"]       = overhead/args.queries
+    output["results"]             = results
+    output["speedup"]             = collections.OrderedDict(
+        (key, results["generic"][key]/results["regular"][key] if results["regular"][key] > 0. else None)
+        for key in results["regular"])
+    if uw.mpi.rank == 0:
+        for key in results["regular"]:
+            print("{:22s} regular {:.3e}s, generic {:.3e}s per point".format(
+                  key, results["regular"][key], results["generic"][key]))
+    bench.write_results(args.output, "regular_queries", output)
+
+
+if __name__ == "__main__":
+    main()
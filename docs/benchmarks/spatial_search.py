@@ -0,0 +1,83 @@
+"""
+Spatial search benchmark for deformed meshes.
+
+A mesh is deformed (so the regular mesh algorithms no longer apply) and a
+mesh variable is then evaluated at random points within the domain, which
+requires locating the element containing each point. The first evaluation
+after each deformation includes rebuilding the spatial index, and is timed
+separately (using a single point) as the rebuild time. The evaluation over
+all points gives the query rate. Run the same script against an earlier
+revision to compare search implementations.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 4 python3 spatial_search.py --res 1000 --queries 1000000 --output search.json
+
+The default 2d resolution gives a 1M element mesh. Use `--help` for the full
+set of options.
+"""
+import argparse
+import collections
+
+import numpy as np
+import underworld as uw
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Spatial search benchmark for deformed meshes.")
+    parser.add_argument("--dim", type=int, default=2, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=1000,
+                        help="Element resolution per axis.")
+    parser.add_argument("--queries", type=int, default=1000000,
+                        help="Number of random query points per process.")
+    parser.add_argument("--repeats", type=int, default=3,
+                        help="Number of deformations. Timings from the fastest are reported.")
+    return bench.parse_args(parser, "spatial_search")
+
+
+
+def main():
+    args = parse_args()
+    dim  = args.dim
+
+    mesh  = uw.mesh.FeMesh_Cartesian(elementType="Q1", elementRes=(args.res,)*dim,
+                                     minCoord=(0.,)*dim, maxCoord=(1.,)*dim)
+    field = mesh.add_variable(1)
+    field.data[:,0] = mesh.data[:,0]
+
+    # query points within the local domain, inset from the deformed boundaries
+    rng    = np.random.RandomState(uw.mpi.rank)
+    lo     = mesh.data[:mesh.nodesLocal].min(axis=0)
+    hi     = mesh.data[:mesh.nodesLocal].max(axis=0)
+    points = lo + 0.1*(hi - lo) + 0.8*(hi - lo)*rng.random_sample((args.queries, dim))
+
+    rebuild = None
+    query   = None
+    for it in range(args.repeats):
+        with mesh.deform_mesh():
+            mesh.data[:,0] += 0.1/args.res*np.sin(np.pi*mesh.data[:,1]*(it+1))
+        wall = bench.timed(field.evaluate, points[:1])
+        rebuild = wall if rebuild is None else min(rebuild, wall)
+        wall = bench.timed(field.evaluate, points)
+        query = wall if query is None else min(query, wall)
+
+    output = collections.OrderedDict()
+    output["dim"]                 = dim
+    output["res"]                 = args.res
+    output["elements"]            = mesh.elementsGlobal
+    output["queries_per_process"] = args.queries
+    output["rebuild_time"]        = rebuild
+    output["query_time"]          = query
+    output["queries_per_second"]  = args.queries*uw.mpi.size/query
+    if uw.mpi.rank == 0:
+        print("{} elements: rebuild {:.4f}s, {:.3e} queries/s".format(
+              mesh.elementsGlobal, rebuild, output["queries_per_second"]))
+    bench.write_results(args.output, "spatial_search", output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,126 @@
+"""
+Stiffness matrix assembly benchmark.
+
+The viscous (K) and gradient (G) matrices of a Stokes system are assembled
+directly with `StiffnessMatrix_Assemble`, as each solve does, and the
+fastest time of each is recorded. Each call makes a single pass over the
+local elements, followed by one combined assembly of the matrix and its
+right hand side vectors, which is where values computed for rows owned by
+other processes are communicated.
+
+To see how the communication grows with the decomposition, the total number
+of element matrix values computed for rows owned by another process is also
+reported, along with the slowest and fastest per process assembly times. Run in 3D at several process counts, eg:
+
+    for np in 8 64 512; do
+        mpirun -np $np python3 stiffness_assembly.py --res 64 --output assembly_$np.json
+    done
+
+For the message counts and sizes of the matrix assembly, set
+`PETSC_OPTIONS=-log_view` and see the MatAssemblyBegin/MatAssemblyEnd
+events.
+
+Results are written by rank 0 as JSON. Use `--help` for the full set of
+options.
+"""
+import argparse
+import collections
+import time
+
+import numpy as np
+from mpi4py import MPI
+import underworld as uw
+from underworld import function as fn
+from underworld import libUnderworld
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Stiffness matrix assembly benchmark.")
+    parser.add_argument("--dim", type=int, default=3, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=32,
+                        help="Element resolution per axis.")
+    parser.add_argument("--element-type", default="Q1/dQ0",
+                        help="Mesh element type, eg 'Q1/dQ0' or 'Q2/dPc1'.")
+    parser.add_argument("--repeats", type=int, default=5,
+                        help="Number of assemblies per matrix. Timings from the fastest are reported.")
+    return bench.parse_args(parser, "stiffness_assembly")
+
+
+def remote_values(rowMesh, rowDofs, colMesh, colDofs):
+    """
+    Returns the number of element matrix values this process computes for
+    rows owned by other processes, summed over all processes.
+    """
+    rowNodes = rowMesh.data_elementNodes[:rowMesh.elementsLocal]
+    remote   = np.count_nonzero(rowNodes >= rowMesh.nodesLocal)
+    local    = remote*rowDofs * colMesh.data_elementNodes.shape[1]*colDofs
+    return uw.mpi.comm.allreduce(int(local))
+
+
+def rank_times(func, *args):
+    """
+    Returns the slowest and fastest time any process spends in the call,
+    with the processes synchronised only beforehand.
+    """
+    uw.mpi.barrier()
+    ts = time.perf_counter()
+    func(*args)
+    local = time.perf_counter() - ts
+    comm  = uw.mpi.comm
+    return comm.allreduce(local, op=MPI.MAX), comm.allreduce(local, op=MPI.MIN)
+
+
+def main():
+    args = parse_args()
+    dim  = args.dim
+
+    mesh  = uw.mesh.FeMesh_Cartesian(elementType=args.element_type, elementRes=(args.res,)*dim,
+                                     minCoord=(0.,)*dim, maxCoord=(1.,)*dim)
+    vel   = uw.mesh.MeshVariable(mesh, dim)
+    press = uw.mesh.MeshVariable(mesh.subMesh, 1)
+    vel.data[:]   = (0.,)*dim
+    press.data[:] = 0.
+
+    coord = fn.input()
+    walls = mesh.specialSets["AllWalls_VertexSet"]
+    bcs   = uw.conditions.DirichletCondition(vel, (walls,)*dim)
+    visc  = fn.math.exp(-2.*coord[dim-1])
+    buoyancy = [0.,]*(dim-1) + [fn.math.sin(3.14159*coord[0]),]
+
+    stokes = uw.systems.Stokes(vel, press, fn_viscosity=visc, fn_bodyforce=buoyancy, conditions=bcs)
+    solver = uw.systems.Solver(stokes)
+    # one solve builds the system and allocates the matrices
+    solver.solve(nonLinearIterate=False)
+
+    results = []
+    for name, matrix, colMesh, colDofs in (("K", stokes._kmatrix, mesh, dim),
+                                           ("G", stokes._gmatrix, mesh.subMesh, 1)):
+        values   = remote_values(mesh, dim, colMesh, colDofs)
+        assemble = lambda: libUnderworld.StgFEM.StiffnessMatrix_Assemble(matrix._cself, stokes._cself, None)
+        best = bench.best_time(args.repeats, assemble)
+        slowest, fastest = min(rank_times(assemble) for it in range(args.repeats))
+        result = collections.OrderedDict()
+        result["matrix"]             = name
+        result["assembly_time"]      = best
+        result["slowest_rank_time"]  = slowest
+        result["fastest_rank_time"]  = fastest
+        result["remote_values"]      = values
+        results.append(result)
+        if uw.mpi.rank == 0:
+            print("{}: assembly {:.4f}s  (per rank {:.4f}s - {:.4f}s)  remote values {}".format(
+                  name, best, fastest, slowest, values), flush=True)
+
+    output = collections.OrderedDict()
+    output["dim"]          = dim
+    output["res"]          = args.res
+    output["element_type"] = args.element_type
+    output["elements"]     = mesh.elementsGlobal
+    output["results"]      = results
+    bench.write_results(args.output, "stiffness_assembly", output)
+
+
+if __name__ == "__main__":
+    main()
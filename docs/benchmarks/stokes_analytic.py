@@ -0,0 +1,180 @@
+"""
+Stokes solver performance benchmark built on the Velic analytic solutions.
+
+Each selected analytic solution (see `underworld.function.analytic`) is solved
+at each requested resolution and element type. For every run the following are
+recorded:
+
+    * setup time (mesh, variables and system construction)
+    * assembly time (time spent in `solve()` outside the linear solver). Pass
+      `--no-jacobian-cache` to measure the effect of element Jacobian caching.
+    * linear solve time and the BSSCR iteration counts
+    * memory high-water mark (per rank maximum and summed over ranks)
+    * velocity and pressure rms errors (absolute and scaled)
+
+Results are written by rank 0 as JSON so that they may be compared across
+releases. Run in parallel by launching with mpirun, eg:
+
+    mpirun -np 4 python3 stokes_analytic.py --res 16 32 64 --output bench.json
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import time
+import collections
+
+import numpy as np
+from mpi4py import MPI
+import underworld as uw
+from underworld import function as fn
+
+import _benchutils as bench
+
+elementTypes = { 1 : "Q1/dQ0",
+                 2 : "Q2/dPc1" }
+
+# solutions exercised by default, with solver tolerances that converge them
+defaultSolns = collections.OrderedDict([
+    ("A",    {"itol":1.e-6, "otol":1.e-6}),
+    ("Cx",   {"itol":1.e-9, "otol":1.e-9}),
+    ("Kx",   {"itol":1.e-4, "otol":1.e-4}),
+    ("Kz",   {"itol":1.e-4, "otol":1.e-4}),
+    ("DB2d", {"itol":1.e-6, "otol":1.e-6}),
+    ("DB3d", {"itol":1.e-8, "otol":1.e-8}),
+])
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Analytic Stokes solver benchmark.")
+    parser.add_argument("--solutions", nargs="+", default=list(defaultSolns.keys()),
+                        help="Analytic solutions to run, eg 'Cx Kz DB3d'.")
+    parser.add_argument("--res", nargs="+", type=int, default=[16,32,64],
+                        help="Element resolutions per axis (halved for 3d solutions).")
+    parser.add_argument("--orders", nargs="+", type=int, default=[1,2], choices=list(elementTypes.keys()),
+                        help="Element orders, 1 for Q1/dQ0 and 2 for Q2/dPc1.")
+    parser.add_argument("--repeats", type=int, default=1,
+                        help="Number of solves per configuration. Timings from the fastest solve are reported.")
+    parser.add_argument("--inner", default="mg",
+                        help="Inner (velocity) solve method passed to `set_inner_method()`.")
+    parser.add_argument("--no-jacobian-cache", dest="jacobian_cache", action="store_false",
+                        help="Disable caching of element Jacobians, to measure its effect on assembly time.")
+    return bench.parse_args(parser, "stokes_analytic")
+
+
+def memory_high_water():
+    """
+    Returns the (per rank max, summed) memory high-water mark in megabytes.
+    """
+    local = bench.peak_resident_bytes() / 1024.**2
+    comm = uw.mpi.comm
+    return comm.allreduce(local, op=MPI.MAX), comm.allreduce(local, op=MPI.SUM)
+
+
+def rms_error(numeric, analytic, mesh):
+    """
+    Returns the absolute and scaled rms error of the numeric solution.
+    """
+    delta        = analytic - numeric
+    intSwarm     = uw.swarm.GaussIntegrationSwarm(mesh, 3)
+    err_abs      = np.sqrt(uw.utils.Integral(fn.math.dot(delta,delta),       mesh, integrationSwarm=intSwarm, integrationType=None).evaluate()[0])
+    sol_abs      = np.sqrt(uw.utils.Integral(fn.math.dot(analytic,analytic), mesh, integrationSwarm=intSwarm, integrationType=None).evaluate()[0])
+    return float(err_abs), float(err_abs/sol_abs)
+
+
+def normalise_press(press, mesh):
+    intSwarm = uw.swarm.GaussIntegrationSwarm(mesh, 3)
+    av_press = uw.utils.Integral(press, mesh, integrationSwarm=intSwarm, integrationType=None).evaluate()[0]
+    return press - av_press
+
+
+def run_case(soln, tolerances, res, order, repeats, inner, jacobian_cache=True):
+    """
+    Builds and solves the numerical system for a single configuration.
+    """
+    dim = soln.dim
+
+    ts = time.perf_counter()
+    mesh  = uw.mesh.FeMesh_Cartesian(elementType=elementTypes[order], elementRes=(res,)*dim,
+                                     minCoord=(0.,)*dim, maxCoord=(1.,)*dim)
+    if not jacobian_cache:
+        uw.libUnderworld.StgFEM.FeMesh_SetJacobianCaching(mesh._cself, False)
+    vel   = uw.mesh.MeshVariable(mesh, dim)
+    press = uw.mesh.MeshVariable(mesh.subMesh, 1)
+    vel.data[:]   = (0.,)*dim
+    press.data[:] = 0.
+    stokes = uw.systems.Stokes(vel, press, fn_viscosity=soln.fn_viscosity, fn_bodyforce=soln.fn_bodyforce,
+                               conditions=[soln.get_bcs(vel),])
+    solver = uw.systems.Solver(stokes)
+    solver.set_inner_method(inner)
+    solver.set_inner_rtol(tolerances["itol"])
+    solver.set_outer_rtol(tolerances["otol"])
+    setup_time = time.perf_counter() - ts
+
+    best = None
+    for it in range(repeats):
+        vel.data[:]   = (0.,)*dim
+        press.data[:] = 0.
+        wall  = bench.timed(solver.solve)
+        stats = solver.get_stats()
+        if (best is None) or (wall < best["wall_time"]):
+            best = { "wall_time"         : wall,
+                     "solve_time"        : stats.total_time,
+                     "assembly_time"     : wall - stats.total_time,
+                     "pressure_its"      : stats.pressure_its,
+                     "velocity_its"      : stats.velocity_total_its,
+                     "pressure_setup_time" : stats.velocity_pressuresolve_setup_time }
+
+    err_vel = rms_error(vel, soln.fn_velocity, mesh)
+    err_pre = rms_error(normalise_press(press, mesh), normalise_press(soln.fn_pressure, mesh), mesh)
+    mem_max, mem_sum = memory_high_water()
+
+    result = collections.OrderedDict()
+    result["dim"]              = dim
+    result["res"]              = res
+    result["element_type"]     = elementTypes[order]
+    result["elements"]         = mesh.elementsGlobal
+    result["velocity_dofs"]    = mesh.nodesGlobal*dim
+    result["setup_time"]       = setup_time
+    result.update(best)
+    result["mem_hwm_max_mb"]   = mem_max
+    result["mem_hwm_total_mb"] = mem_sum
+    result["vel_err_abs"], result["vel_err_scaled"] = err_vel
+    result["pre_err_abs"], result["pre_err_scaled"] = err_pre
+    return result
+
+
+def main():
+    args = parse_args()
+
+    solns = collections.OrderedDict()
+    for name in args.solutions:
+        clsname = "Sol"+name
+        if not hasattr(fn.analytic, clsname):
+            raise ValueError("Analytic solution '{}' not found in `underworld.function.analytic`.".format(clsname))
+        solns[name] = getattr(fn.analytic, clsname)()
+
+    results = []
+    for name, soln in solns.items():
+        if soln.nonlinear:
+            if uw.mpi.rank == 0:
+                print("Skipping nonlinear solution {}.".format(name), flush=True)
+            continue
+        tolerances = defaultSolns.get(name, {"itol":1.e-6, "otol":1.e-6})
+        for order in args.orders:
+            for res in args.res:
+                res_ = int(round(res/2.)) if soln.dim == 3 else res
+                if uw.mpi.rank == 0:
+                    print("Running Sol{} {} res={}".format(name, elementTypes[order], res_), flush=True)
+                result = run_case(soln, tolerances, res_, order, args.repeats, args.inner, args.jacobian_cache)
+                result["solution"] = name
+                results.append(result)
+
+    output = collections.OrderedDict()
+    output["inner"]          = args.inner
+    output["jacobian_cache"] = args.jacobian_cache
+    output["results"]        = results
+    bench.write_results(args.output, "stokes_analytic", output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,83 @@
+"""
+Surface deformation benchmark.
+
+A Q1/dQ0 mesh (with its pressure submesh) is deformed for a series of steps,
+in the manner of a free surface model, where only the top row of nodes is
+moved each step. The same number of steps is then taken with every node of
+the mesh moved. Only the exit from `deform_mesh()` (synchronising the mesh
+and updating the mesh geometry, metrics and submesh) is timed for each step.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 8 python3 surface_deformation.py --res 256 --steps 20 --output surface.json
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import time
+import collections
+
+import numpy as np
+import underworld as uw
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Surface deformation benchmark.")
+    parser.add_argument("--dim", type=int, default=2, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=256,
+                        help="Element resolution per axis.")
+    parser.add_argument("--steps", type=int, default=20,
+                        help="Number of deformation steps for each case.")
+    return bench.parse_args(parser, "surface_deformation")
+
+
+def deform_steps(mesh, nodes, steps):
+    """
+    Moves the given nodes vertically for each step, returning the time taken
+    to exit `deform_mesh()` for each step.
+    """
+    dim   = mesh.dim
+    times = []
+    for step in range(steps):
+        with mesh.deform_mesh():
+            height = mesh.data[nodes,dim-1]
+            mesh.data[nodes,dim-1] = height + 1.e-4*height*np.sin(np.pi*mesh.data[nodes,0]*(step+1))
+            uw.mpi.barrier()
+            ts = time.perf_counter()
+        uw.mpi.barrier()
+        times.append(time.perf_counter() - ts)
+    return times
+
+
+def main():
+    args = parse_args()
+    dim  = args.dim
+
+    mesh = uw.mesh.FeMesh_Cartesian(elementType="Q1/dQ0", elementRes=(args.res,)*dim,
+                                    minCoord=(0.,)*dim, maxCoord=(1.,)*dim)
+    top  = mesh.specialSets["MaxK_VertexSet" if dim == 3 else "MaxJ_VertexSet"].data
+    everything = np.arange(mesh.nodesDomain)
+
+    surface = deform_steps(mesh, top, args.steps)
+    mesh.reset()
+    full    = deform_steps(mesh, everything, args.steps)
+
+    output = collections.OrderedDict()
+    output["dim"]                    = dim
+    output["res"]                    = args.res
+    output["mean_surface_step_time"] = sum(surface)/len(surface)
+    output["mean_full_step_time"]    = sum(full)/len(full)
+    output["surface_step_times"]     = surface
+    output["full_step_times"]        = full
+    if uw.mpi.rank == 0:
+        print("deformation update: surface {:.4f}s, full {:.4f}s per step".format(
+              output["mean_surface_step_time"], output["mean_full_step_time"]))
+    bench.write_results(args.output, "surface_deformation", output)
+
+
+if __name__ == "__main__":
+    main()
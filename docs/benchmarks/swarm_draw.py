@@ -0,0 +1,86 @@
+"""
+Swarm points drawing benchmark.
+
+A swarm is populated with the requested number of particles and a points
+drawing object, with colour, size and mask functions, is drawn repeatedly.
+Only the draw (evaluation of the drawing object functions at each particle
+and collation of the geometry for output) is timed, the geometry is
+discarded after each draw without being gathered or written to the database.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 4 python3 swarm_draw.py --particles 1e7 --output draw.json
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import collections
+
+import underworld as uw
+from underworld import function as fn
+import underworld.visualisation as vis
+from underworld import libUnderworld
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Swarm points drawing benchmark.")
+    parser.add_argument("--particles", type=float, default=1e7,
+                        help="Approximate global particle count.")
+    parser.add_argument("--res", type=int, default=256,
+                        help="Element resolution per axis (2d), particle counts are rounded to whole particles per cell.")
+    parser.add_argument("--repeats", type=int, default=3,
+                        help="Number of draws. Timings from the fastest draw are reported.")
+    return bench.parse_args(parser, "swarm_draw")
+
+
+def main():
+    args = parse_args()
+
+    mesh  = uw.mesh.FeMesh_Cartesian(elementType="Q1", elementRes=(args.res,args.res),
+                                     minCoord=(0.,0.), maxCoord=(1.,1.))
+    ppc   = max(1, int(round(args.particles/mesh.elementsGlobal)))
+    swarm = uw.swarm.Swarm(mesh=mesh)
+    swarm.populate_using_layout(uw.swarm.layouts.PerCellSpaceFillerLayout(swarm, particlesPerCell=ppc))
+    coord = fn.input()
+
+    cases = collections.OrderedDict()
+    cases["position"] = {}
+    cases["colour"]   = {"fn_colour":coord[0]}
+    cases["all"]      = {"fn_colour":coord[0], "fn_size":1.+coord[1], "fn_mask":coord[0] < 0.5}
+
+    results = []
+    for name, fns in cases.items():
+        store  = vis.Store()
+        fig    = vis.Figure(store, name=name)
+        points = vis.objects.Points(swarm, colourBar=False, **fns)
+        fig.append(points)
+        # generate once to set up the drawing object and database
+        fig.save()
+
+        times = []
+        for it in range(args.repeats):
+            times.append(bench.timed(libUnderworld.gLucifer._lucSwarmViewer_Draw, points._dr, store._db, None))
+            libUnderworld.gLucifer.lucDatabase_ClearGeometry(store._db)
+        best = min(times)
+
+
+        result = collections.OrderedDict()
+        result["case"]      = name
+        result["draw_time"] = best
+        result["particles_per_second"] = swarm.particleGlobalCount/best
+        results.append(result)
+        if uw.mpi.rank == 0:
+            print("{:10s} draw {:.4f}s  ({:.3e} particles/s)".format(name, best, result["particles_per_second"]), flush=True)
+
+    output = collections.OrderedDict()
+    output["particles"]          = swarm.particleGlobalCount
+    output["particles_per_cell"] = ppc
+    output["results"]            = results
+    bench.write_results(args.output, "swarm_draw", output)
+
+
+if __name__ == "__main__":
+    main()
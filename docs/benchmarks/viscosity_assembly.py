@@ -0,0 +1,101 @@
+"""
+Stokes assembly benchmark for different viscosity function dependencies.
+
+The viscous stiffness matrix is assembled for an isoviscous, a temperature
+dependent and a strain-rate dependent viscosity, so that the cost of
+evaluating the viscosity function (and any mesh variable values or
+gradients it requires) at each integration particle may be compared.
+Assembly time is taken as the time spent in `solve()` outside the linear
+solver, with a single (non iterated) solve per repeat.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 4 python3 viscosity_assembly.py --dim 3 --res 32 --output visc.json
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import collections
+
+import underworld as uw
+from underworld import function as fn
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Viscosity function assembly benchmark.")
+    parser.add_argument("--dim", type=int, default=2, choices=[2,3],
+                        help="Model dimensionality.")
+    parser.add_argument("--res", type=int, default=64,
+                        help="Element resolution per axis.")
+    parser.add_argument("--element-type", default="Q1/dQ0",
+                        help="Mesh element type, eg 'Q1/dQ0' or 'Q2/dPc1'.")
+    parser.add_argument("--repeats", type=int, default=3,
+                        help="Number of solves per case. Timings from the fastest solve are reported.")
+    return bench.parse_args(parser, "viscosity_assembly")
+
+
+def viscosity_cases(velocity, temperature):
+    """
+    Returns the viscosity functions to benchmark.
+    """
+    strainRate  = fn.tensor.symmetric(velocity.fn_gradient)
+    strainRate2 = fn.tensor.second_invariant(strainRate)
+    cases = collections.OrderedDict()
+    cases["isoviscous"]           = 1.
+    cases["temperature"]          = fn.math.exp(-2.*temperature)
+    cases["strainrate"]           = fn.misc.min(1.e3, fn.misc.max(1.e-3, 0.5/(strainRate2+1.e-8)))
+    cases["temperature_strainrate"] = fn.misc.min(1.e3, fn.math.exp(-2.*temperature)/(strainRate2+1.e-3))
+    return cases
+
+
+def main():
+    args = parse_args()
+    dim  = args.dim
+
+    mesh  = uw.mesh.FeMesh_Cartesian(elementType=args.element_type, elementRes=(args.res,)*dim,
+                                     minCoord=(0.,)*dim, maxCoord=(1.,)*dim)
+    vel   = uw.mesh.MeshVariable(mesh, dim)
+    press = uw.mesh.MeshVariable(mesh.subMesh, 1)
+    temp  = uw.mesh.MeshVariable(mesh, 1)
+    coord = fn.input()
+    temp.data[:]  = coord.evaluate(mesh)[:,dim-1:dim]
+    vel.data[:]   = (0.,)*dim
+    press.data[:] = 0.
+
+    walls = mesh.specialSets["AllWalls_VertexSet"]
+    bcs   = uw.conditions.DirichletCondition(vel, (walls,)*dim)
+    buoyancy = [0.,]*(dim-1) + [fn.math.sin(3.14159*coord[0])*temp,]
+
+    results = []
+    for name, visc in viscosity_cases(vel, temp).items():
+        stokes = uw.systems.Stokes(vel, press, fn_viscosity=visc, fn_bodyforce=buoyancy, conditions=bcs)
+        solver = uw.systems.Solver(stokes)
+        best = None
+        for it in range(args.repeats):
+            wall  = bench.timed(solver.solve, nonLinearIterate=False)
+            stats = solver.get_stats()
+            if (best is None) or (wall < best["wall_time"]):
+                best = { "wall_time"     : wall,
+                         "solve_time"    : stats.total_time,
+                         "assembly_time" : wall - stats.total_time }
+        result = collections.OrderedDict()
+        result["case"] = name
+        result.update(best)
+        results.append(result)
+        if uw.mpi.rank == 0:
+            print("{:24s} assembly {:.4f}s  solve {:.4f}s".format(name, best["assembly_time"], best["solve_time"]), flush=True)
+
+    output = collections.OrderedDict()
+    output["dim"]          = dim
+    output["res"]          = args.res
+    output["element_type"] = args.element_type
+    output["elements"]     = mesh.elementsGlobal
+    output["results"]      = results
+    bench.write_results(args.output, "viscosity_assembly", output)
+
+
+if __name__ == "__main__":
+    main()
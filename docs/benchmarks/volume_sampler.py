@@ -0,0 +1,109 @@
+"""
+Volume sampling benchmark for a time series of frames.
+
+A scalar mesh variable on a 3d mesh is drawn as a volume, sampled over a
+regular grid of the requested resolution, for a series of frames with the
+field updated between each. The first frame locates every sample point in
+the mesh, subsequent frames reuse the located elements and local coordinates
+while the mesh is undeformed. The mesh is then deformed and a further series
+of frames drawn, so that the first frame after deformation again includes
+locating the samples. Each frame is set up and drawn as when the figure is
+saved, and only this is timed, the geometry is discarded after each frame
+without being written to the database. The number of planes held in the
+sample cache is checked to stay the same from frame to frame.
+
+Results are written by rank 0 as JSON. Run in parallel by launching with
+mpirun, eg:
+
+    mpirun -np 4 python3 volume_sampler.py --samples 64 --frames 10 --output volume.json
+
+Use `--help` for the full set of options.
+"""
+import argparse
+import collections
+
+import numpy as np
+import underworld as uw
+from underworld import function as fn
+import underworld.visualisation as vis
+from underworld import libUnderworld
+
+import _benchutils as bench
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Volume sampling benchmark.")
+    parser.add_argument("--samples", type=int, default=64,
+                        help="Volume sampling resolution per axis.")
+    parser.add_argument("--res", type=int, default=32,
+                        help="Element resolution per axis.")
+    parser.add_argument("--frames", type=int, default=10,
+                        help="Number of frames drawn before and after deforming the mesh.")
+    return bench.parse_args(parser, "volume_sampler")
+
+
+def draw_frame(volume, store):
+    libUnderworld.gLucifer._lucCrossSection_Setup(volume._dr, store._db, None)
+    libUnderworld.gLucifer._lucFieldSampler_Draw(volume._dr, store._db, None)
+
+
+def draw_frames(mesh, field, volume, store, frames):
+    """
+    Updates the field and draws the volume for each frame, returning the frame times
+    and the number of cached sample planes.
+    """
+    times = []
+    for frame in range(frames):
+        field.data[:,0] = np.sin(mesh.data[:,0]*(frame+1))*mesh.data[:,1]
+        times.append(bench.timed(draw_frame, volume, store))
+        libUnderworld.gLucifer.lucDatabase_ClearGeometry(store._db)
+
+        planes = libUnderworld.gLucifer.lucCrossSection_GetNumCachedPlanes(volume._dr)
+        if frame == 0:
+            first = planes
+        elif planes != first:
+            raise RuntimeError("Sample cache changed from {} to {} planes on frame {}.".format(first, planes, frame))
+    return times, first
+
+
+def main():
+    args = parse_args()
+
+    mesh   = uw.mesh.FeMesh_Cartesian(elementType="Q1", elementRes=(args.res,)*3,
+                                      minCoord=(0.,)*3, maxCoord=(1.,)*3)
+    field  = uw.mesh.MeshVariable(mesh, 1)
+    store  = vis.Store()
+    fig    = vis.Figure(store, name="volume")
+    volume = vis.objects.Volume(mesh, field, resolution=[args.samples,]*3, colourBar=False)
+    fig.append(volume)
+    # generate once to set up the drawing object and database
+    fig.save()
+    # discard locations from the setup frame so the first timed frame locates samples
+    # (the geometry is only updated where vertices actually move)
+    with mesh.deform_mesh():
+        mesh.data[0] += 1.e-6
+    mesh.reset()
+
+    static, planes = draw_frames(mesh, field, volume, store, args.frames)
+    with mesh.deform_mesh():
+        mesh.data[:,2] += 0.01*np.sin(np.pi*mesh.data[:,0])*mesh.data[:,2]*(1.-mesh.data[:,2])
+    deformed, planes = draw_frames(mesh, field, volume, store, args.frames)
+
+    output = collections.OrderedDict()
+    output["res"]                           = args.res
+    output["samples"]                       = args.samples
+    output["cached_planes"]                 = planes
+    output["first_frame_time"]              = static[0]
+    output["cached_frame_time"]             = min(static[1:]) if len(static) > 1 else None
+    output["first_frame_after_deform_time"] = deformed[0]
+    output["static_frame_times"]            = static
+    output["deformed_frame_times"]          = deformed
+    if uw.mpi.rank == 0:
+        print("{0}^3 volume: first frame {1:.4f}s, cached frame {2}".format(
+              args.samples, static[0],
+              "{:.4f}s".format(output["cached_frame_time"]) if len(static) > 1 else "n/a"))
+    bench.write_results(args.output, "volume_sampler", output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,47 @@
+'''
+This script tests that a failed figure save does not prevent later saves.
+
+Each timestep is written to the store in a single transaction. If drawing
+raises before the transaction is committed, it must be discarded so that
+the next save can begin its own transaction.
+'''
+import underworld as uw
+import underworld.visualisation as vis
+import os
+import sqlite3
+
+filename = "glucifer_failed_save.gldb"
+
+mesh    = uw.mesh.FeMesh_Cartesian(elementRes=(8,8))
+store   = vis.Store(filename.split('.')[0])
+fig     = vis.Figure(store)
+surface = vis.objects.Surface(mesh, uw.function.input()[0])
+fig.append(surface)
+
+# object properties are written as json with the visualisation state,
+# so an unserialisable property raises after the geometry is drawn
+surface["unserialisable"] = object()
+try:
+    fig.save()
+except TypeError:
+    pass
+else:
+    raise RuntimeError("Figure save with an unserialisable property should have raised.")
+
+# remove the cause, and confirm this and the following timestep are saved
+del surface.properties["unserialisable"]
+fig.save()
+store.step += 1
+fig.save()
+
+if uw.mpi.rank == 0:
+    db = sqlite3.connect(filename)
+    steps = [row[0] for row in db.execute("select id from timestep order by id")]
+    if steps != [0,1]:
+        raise RuntimeError("Expected timesteps [0, 1] in the store after a failed save, found {}.".format(steps))
+    for step in steps:
+        count = db.execute("select count(*) from geometry where timestep=?", (step,)).fetchone()[0]
+        if count == 0:
+            raise RuntimeError("No geometry saved for timestep {} after a failed save.".format(step))
+    db.close()
+    os.remove(filename)
@@ -0,0 +1,41 @@
+'''
+This script tests that the sample cache of cross section drawing objects does
+not grow as frames are saved.
+
+Each plane drawn in a frame keeps the elements and local coordinates of its
+samples for the next frame, so the number of planes held must stay the same
+across repeated saves, including after the mesh is deformed.
+'''
+import underworld as uw
+import underworld.visualisation as vis
+from underworld import libUnderworld
+import numpy as np
+
+mesh    = uw.mesh.FeMesh_Cartesian(elementRes=(8,8,8))
+field   = mesh.add_variable(1)
+store   = vis.Store()
+fig     = vis.Figure(store)
+surface = vis.objects.Surface(mesh, field, resolution=[16,16,1])
+volume  = vis.objects.Volume(mesh, field, resolution=[8,8,8])
+fig.append(surface)
+fig.append(volume)
+
+def cached_planes():
+    return [ libUnderworld.gLucifer.lucCrossSection_GetNumCachedPlanes(obj._dr) for obj in (surface, volume) ]
+
+expected = None
+for step in range(4):
+    if step == 2:
+        with mesh.deform_mesh():
+            mesh.data[:,2] += 0.01*np.sin(np.pi*mesh.data[:,0])*mesh.data[:,2]*(1.-mesh.data[:,2])
+    field.data[:,0] = np.sin(mesh.data[:,0]*(step+1))*mesh.data[:,1]
+    fig.save()
+    store.step += 1
+
+    planes = cached_planes()
+    if expected is None:
+        expected = planes
+        if 0 in expected:
+            raise RuntimeError("Expected sample planes to be cached after the first save, found {}.".format(expected))
+    elif planes != expected:
+        raise RuntimeError("Sample cache changed from {} to {} planes on step {}.".format(expected, planes, step))
@@ -49,6 +49,8 @@ PetscErrorCode BSSCR_BSSCR_StokesCreatePCSchur2(
    Mat K, Mat G, Mat D, Mat C, Mat Smat, PC pc_S,
    PetscTruth sym, KSP_BSSCR * bsscrp );
 
+PetscErrorCode BSSCR_StokesSchurPCReuseUpdate( KSP ksp_S, double scrSetupTime, KSP_BSSCR * bsscrp );
+
 PetscErrorCode BSSCR_KSPConverged(KSP ksp,PetscInt n,PetscReal rnorm,KSPConvergedReason *reason,void *cctx);
 PetscErrorCode BSSCR_KSPSetConvergenceMinIts(KSP ksp, PetscInt n, KSP_BSSCR * bsscr);
 PetscErrorCode BSSCR_KSPConverged_Destroy(void *cctx);
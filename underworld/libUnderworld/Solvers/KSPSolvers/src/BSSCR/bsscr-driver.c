@@ -101,6 +101,7 @@ PetscErrorCode BSSCR_DRIVER_flex( KSP ksp, Mat stokes_A, Vec stokes_x, Vec stoke
 
     double t0, t1;
     double mgSetupTime, rhsSolveTime, problemBuildTime, scrSolveTime, a11SingleSolveTime, solutionAnalysisTime;
+    double scrSetupTime;
     Index nx,ny,nz;
     PetscInt j,start,end;
 
@@ -264,7 +265,11 @@ PetscErrorCode BSSCR_DRIVER_flex( KSP ksp, Mat stokes_A, Vec stokes_x, Vec stoke
     if(found && min_it > 0){
         BSSCR_KSPSetConvergenceMinIts(ksp_S, min_it, bsscrp_self);
     }
+    scrSetupTime = MPI_Wtime();
+    KSPSetUp(ksp_S);
+    scrSetupTime = MPI_Wtime() - scrSetupTime;
     KSPSolve( ksp_S, h_hat, p );
+    BSSCR_StokesSchurPCReuseUpdate( ksp_S, scrSetupTime, bsscrp_self );
     sprintf(pafter,"psafter_%d",been_here);
     // bsscr_writeVec( p, pafter, "Writing p Vector in Solver");
     /***************************************/
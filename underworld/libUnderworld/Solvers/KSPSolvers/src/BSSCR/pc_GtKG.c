@@ -66,6 +66,7 @@ typedef struct {
 	Vec         s,t,X;  /* s \in [M], t \in [N], X \in [M] */
 	PetscTruth  monitor_activated;
 	PetscTruth  monitor_rhs_consistency;
+	PetscTruth  reuse_GtG; /* take GtG (and its factorisation) from the operator already on ksp */
 } _PC_GtKG;
 
 typedef _PC_GtKG* PC_GtKG;
@@ -185,6 +186,29 @@ PetscErrorCode BSSCR_PCSetUp_GtKG( PC pc )
 	}
 	
 	
+	/*
+	The ksp was handed over from a previous solve (see BSSCR_PCGtKGSet_KSP) with GtG
+	already set as its operator. GtG depends only on G and M, which change with the mesh
+	geometry; the caller only hands the ksp over while the geometry is unchanged
+	(see BSSCR_BSSCR_StokesCreatePCSchur2). Here we only guard against a change in size,
+	keeping GtG together with whatever factorisation the ksp holds.
+	*/
+	if( ctx->reuse_GtG == PETSC_TRUE ) {
+		Mat      GtG_old;
+		PetscInt Mo,No;
+		
+		Stg_KSPGetOperators( ctx->ksp, &GtG_old, PETSC_NULL, PETSC_NULL );
+		MatGetSize( ctx->G, &M, &N );
+		MatGetSize( GtG_old, &Mo, &No );
+		if( Mo == N && No == N ) {
+			PetscObjectReference( (PetscObject)GtG_old );
+			ctx->GtG = GtG_old;
+			PetscFunctionReturn(0);
+		}
+		ctx->reuse_GtG = PETSC_FALSE;
+	}
+	
+	
 	/* Assemble GtG */
 	MatGetSize( ctx->G, &M, &N );
 	MatGetLocalSize( ctx->G, &m, &n );
@@ -577,6 +601,7 @@ PetscErrorCode BSSCR_PCCreate_GtKG( PC pc )
 	pc_data->ksp               = PETSC_NULL;
 	pc_data->monitor_activated = PETSC_FALSE;
 	pc_data->monitor_rhs_consistency = PETSC_FALSE;
+	pc_data->reuse_GtG         = PETSC_FALSE;
 	
 	pc_data->s = PETSC_NULL;
 	pc_data->t = PETSC_NULL;
@@ -688,5 +713,34 @@ PetscErrorCode BSSCR_PCGtKGSet_KSP( PC pc, KSP ksp )
 	
 	PetscFunctionReturn(0);
 }
+
+/*
+Use the operator already attached to the ksp given via BSSCR_PCGtKGSet_KSP as GtG,
+rather than forming G^T G again during setup. The ksp is not reconfigured from the
+options database, so any factorisation it holds survives.
+*/
+PetscErrorCode BSSCR_PCGtKGSet_ReuseOperator( PC pc, PetscTruth flg )
+{
+	PC_GtKG ctx = (PC_GtKG)pc->data;
+	
+	BSSCR_pc_error( pc, "__func__" );
+	
+	ctx->reuse_GtG = flg;
+	
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode BSSCR_PCGtKGGet_ReuseOperator( PC pc, PetscTruth *flg )
+{
+	PC_GtKG ctx = (PC_GtKG)pc->data;
+	
+	BSSCR_pc_error( pc, "__func__" );
+	
+	if( flg != PETSC_NULL ) {
+		(*flg) = ctx->reuse_GtG;
+	}
+	
+	PetscFunctionReturn(0);
+}
 #endif
 
@@ -23,5 +23,7 @@ PetscErrorCode BSSCR_PCGtKGGet_KSP( PC pc, KSP *ksp );
 PetscErrorCode BSSCR_PCGtKGAttachNullSpace( PC pc );
 PetscErrorCode BSSCR_PCGtKGSet_OperatorForAlgebraicCommutator( PC pc, Mat M );
 PetscErrorCode BSSCR_PCGtKGSet_KSP( PC pc, KSP ksp );
+PetscErrorCode BSSCR_PCGtKGSet_ReuseOperator( PC pc, PetscTruth flg );
+PetscErrorCode BSSCR_PCGtKGGet_ReuseOperator( PC pc, PetscTruth *flg );
 
 #endif
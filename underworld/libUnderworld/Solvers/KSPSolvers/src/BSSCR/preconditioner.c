@@ -20,6 +20,7 @@
 #include "Solvers/KSPSolvers/src/KSPSolvers.h" /* for __KSP_COMMON */
 #include "BSSCR.h"
 #include "writeMatVec.h"
+#include "pc_GtKG.h"
 
 #if( (PETSC_VERSION_MAJOR==2) && (PETSC_VERSION_MINOR==3) && (PETSC_VERSION_SUBMINOR==0) )
 #define FILE_OPTION PETSC_FILE_RDONLY
@@ -135,12 +136,201 @@ PetscErrorCode BSSCR_StokesCreatePCSchur( Mat K, Mat G, PC pc_S )
 
 
 
+/*
+
+Schur preconditioner reuse (-Q22_pc_reuse).
+
+The uwscale/gkgdiag operators G^T diag(K)^{-1} G and the gtkg operator G^T G (along
+with the inner ksp which factors it) are normally rebuilt for every solve. With reuse
+enabled they are kept on the StokesBlockKSPInterface between solves.
+
+G (and M) change whenever the velocity mesh is deformed or remeshed, even though the
+sizes stay the same, so both are rebuilt whenever the mesh geometryVersion differs from
+the one they were formed on. G^T G depends on nothing else. The uwscale/gkgdiag
+operators also depend on the viscosity through diag(K), so these are additionally
+rebuilt once the outer (scr) iteration count grows beyond -Q22_pc_reuse_its_factor
+times the count observed straight after the last rebuild.
+
+With -rescale_equations the retained operators are formed from the scaled K and G, and
+the scaling is rebuilt from K for every solve. Once K has been reassembled the stored
+scaling no longer matches the current one, so everything is rebuilt; reuse then only
+pays off between solves which do not reassemble K.
+
+Both drivers (auglag and flex) report back through BSSCR_StokesSchurPCReuseUpdate.
+
+*/
+static void BSSCR_StokesSchurPCReuseClear( StokesBlockKSPInterface* Solver )
+{
+	if( Solver->Shat_reuse )    Stg_MatDestroy( &Solver->Shat_reuse );
+	if( Solver->ksp_GtG_reuse ) Stg_KSPDestroy( &Solver->ksp_GtG_reuse );
+	Solver->schur_pc_rebuild = PETSC_TRUE;
+}
+
+static Mesh* BSSCR_StokesSchurPCReuseMesh( StokesBlockKSPInterface* Solver )
+{
+	Stokes_SLE* sle = Solver->st_sle;
+
+	if( !sle || !sle->gStiffMat || !sle->gStiffMat->rowVariable ) return NULL;
+	return (Mesh*)sle->gStiffMat->rowVariable->feMesh;
+}
+
+static unsigned BSSCR_StokesSchurPCReuseKVersion( StokesBlockKSPInterface* Solver )
+{
+	Stokes_SLE* sle = Solver->st_sle;
+
+	return ( sle && sle->kStiffMat ) ? sle->kStiffMat->assemblyVersion : 0;
+}
+
+/* Notes the geometry, and the assembly of K behind any scaling, the retained operator was formed on. */
+static void BSSCR_StokesSchurPCReuseRecordOperators( StokesBlockKSPInterface* Solver )
+{
+	Mesh* mesh = BSSCR_StokesSchurPCReuseMesh( Solver );
+
+	Solver->schur_pc_mesh        = mesh;
+	Solver->schur_pc_meshVersion = mesh ? mesh->geometryVersion : 0;
+	Solver->schur_pc_kVersion    = BSSCR_StokesSchurPCReuseKVersion( Solver );
+}
+
+static PetscTruth BSSCR_StokesSchurPCReuseMeshChanged( StokesBlockKSPInterface* Solver )
+{
+	Mesh* mesh = BSSCR_StokesSchurPCReuseMesh( Solver );
+
+	if( !mesh || mesh != Solver->schur_pc_mesh ) return PETSC_TRUE;
+	return ( mesh->geometryVersion != Solver->schur_pc_meshVersion ) ? PETSC_TRUE : PETSC_FALSE;
+}
+
+static PetscTruth BSSCR_StokesSchurPCReuseSizesMatch( Mat A, Mat G )
+{
+	PetscInt M,N,m,n,Mg,Ng,mg,ng;
+
+	MatGetSize( A, &M, &N );
+	MatGetLocalSize( A, &m, &n );
+	MatGetSize( G, &Mg, &Ng );
+	MatGetLocalSize( G, &mg, &ng );
+
+	return ( M==Ng && N==Ng && m==ng && n==ng ) ? PETSC_TRUE : PETSC_FALSE;
+}
+
+/*
+Builds Shat with the given routine, or hands back the one retained from a previous solve.
+The retained matrix is named after the Q22_pc_type which formed it.
+*/
+static PetscErrorCode BSSCR_StokesSchurPCReuseShat(
+   const char pc_type[], PetscErrorCode (*form)( Mat, Mat, Mat, Mat, Mat*, PetscTruth ),
+   Mat K, Mat G, Mat D, Mat C, Mat *Shat, PetscTruth sym, StokesBlockKSPInterface* Solver )
+{
+	double setupTime;
+	const char *name;
+
+	if( Solver->schur_pc_reuse ) {
+		if( Solver->ksp_GtG_reuse ) Stg_KSPDestroy( &Solver->ksp_GtG_reuse );
+
+		if( Solver->Shat_reuse ) {
+			PetscObjectGetName( (PetscObject)Solver->Shat_reuse, &name );
+			if( strcmp(name,pc_type)!=0 ) BSSCR_StokesSchurPCReuseClear( Solver );
+		}
+		if( Solver->Shat_reuse && !Solver->schur_pc_rebuild &&
+		    BSSCR_StokesSchurPCReuseSizesMatch( Solver->Shat_reuse, G ) ) {
+			PetscObjectReference( (PetscObject)Solver->Shat_reuse );
+			*Shat = Solver->Shat_reuse;
+			Solver->schur_pc_rebuilt = PETSC_FALSE;
+			return 0;
+		}
+	}
+
+	setupTime = MPI_Wtime();
+	form( K, G, D, C, Shat, sym );
+	setupTime = MPI_Wtime() - setupTime;
+
+	if( Solver->schur_pc_reuse ) {
+		if( Solver->Shat_reuse ) Stg_MatDestroy( &Solver->Shat_reuse );
+		PetscObjectReference( (PetscObject)*Shat );
+		PetscObjectSetName( (PetscObject)*Shat, pc_type );
+		Solver->Shat_reuse = *Shat;
+		BSSCR_StokesSchurPCReuseRecordOperators( Solver );
+		Solver->schur_pc_rebuild = PETSC_FALSE;
+		Solver->schur_pc_rebuilt = PETSC_TRUE;
+		Solver->stats.schur_pc_setup_time = setupTime;
+	}
+
+	return 0;
+}
+
+/*
+Called once the scr solve has completed. Retains the gtkg inner ksp, updates the reuse
+statistics and decides whether the preconditioner needs rebuilding for the next solve.
+For gtkg the setup time is only known to the driver, so it is passed in here.
+*/
+PetscErrorCode BSSCR_StokesSchurPCReuseUpdate( KSP ksp_S, double scrSetupTime, KSP_BSSCR * bsscrp )
+{
+	StokesBlockKSPInterface* Solver = bsscrp->solver;
+	PC pc_S;
+	const PCType type;
+	PetscInt its;
+	PetscReal factor;
+	PetscTruth flg, is_gtkg;
+
+	if( !Solver->schur_pc_reuse ) return 0;
+
+	KSPGetIterationNumber( ksp_S, &its );
+	KSPGetPC( ksp_S, &pc_S );
+	PCGetType( pc_S, &type );
+	is_gtkg = ( type && strcmp(type,"gtkg")==0 ) ? PETSC_TRUE : PETSC_FALSE;
+
+	if( is_gtkg ) {
+		KSP ksp_GtG;
+		PetscTruth reused;
+
+		/* the pc falls back to forming GtG itself if the retained operator no longer fits */
+		BSSCR_PCGtKGGet_ReuseOperator( pc_S, &reused );
+		Solver->schur_pc_rebuilt = reused ? PETSC_FALSE : PETSC_TRUE;
+
+		BSSCR_PCGtKGGet_KSP( pc_S, &ksp_GtG );
+		if( ksp_GtG != Solver->ksp_GtG_reuse ) {
+			if( Solver->ksp_GtG_reuse ) Stg_KSPDestroy( &Solver->ksp_GtG_reuse );
+			PetscObjectReference( (PetscObject)ksp_GtG );
+			Solver->ksp_GtG_reuse = ksp_GtG;
+		}
+		if( Solver->schur_pc_rebuilt ) {
+			Solver->stats.schur_pc_setup_time = scrSetupTime;
+			BSSCR_StokesSchurPCReuseRecordOperators( Solver );
+			Solver->schur_pc_rebuild = PETSC_FALSE;
+		}
+	}
+	else if( !Solver->Shat_reuse ) {
+		return 0; /* nothing of this Q22_pc_type is retained */
+	}
+
+	if( Solver->schur_pc_rebuilt ) {
+		Solver->stats.schur_pc_rebuilds++;
+		Solver->schur_pc_ref_its = (int)its;
+		return 0;
+	}
+
+	Solver->stats.schur_pc_reuses++;
+	Solver->stats.schur_pc_time_saved += Solver->stats.schur_pc_setup_time;
+
+	/* G^T G only changes with the geometry, which is checked before each solve */
+	if( is_gtkg ) return 0;
+
+	factor = 1.5;
+	PetscOptionsGetReal( PETSC_NULL, "-Q22_pc_reuse_its_factor", &factor, &flg );
+	if( (PetscReal)its > factor*(PetscReal)Solver->schur_pc_ref_its ) {
+		PetscPrintf( PETSC_COMM_WORLD, "  Schur pc took %d its (%d after last rebuild), rebuilding for next solve\n",
+			(int)its, Solver->schur_pc_ref_its );
+		Solver->schur_pc_rebuild = PETSC_TRUE;
+	}
+
+	return 0;
+}
+
 PetscErrorCode BSSCR_BSSCR_StokesCreatePCSchur2(
    Mat K, Mat G, Mat D, Mat C, Mat Smat, PC pc_S,
    PetscTruth sym, KSP_BSSCR * bsscrp )
 {
 	char pc_type[PETSC_MAX_PATH_LEN];
-	PetscTruth flg;
+	PetscTruth flg, reuse;
+	StokesBlockKSPInterface* Solver = bsscrp->solver;
 
 
 	PetscOptionsGetString( PETSC_NULL, "-Q22_pc_type", pc_type, PETSC_MAX_PATH_LEN-1, &flg );
@@ -149,6 +339,20 @@ PetscErrorCode BSSCR_BSSCR_StokesCreatePCSchur2(
 	    //Stg_SETERRQ( PETSC_ERR_SUP, "OPTION: -Q22_pc_type must be set" );
 	}
 
+	reuse = PETSC_FALSE;
+	PetscOptionsGetTruth( PETSC_NULL, "-Q22_pc_reuse", &reuse, &flg );
+	Solver->schur_pc_reuse   = reuse;
+	Solver->schur_pc_rebuilt = PETSC_FALSE;
+	if( !reuse || strcmp(pc_type,"none")==0 || strcmp(pc_type,"uw")==0 ) {
+		BSSCR_StokesSchurPCReuseClear( Solver ); /* nothing worth retaining for these */
+	}
+	else if( BSSCR_StokesSchurPCReuseMeshChanged( Solver ) ) {
+		Solver->schur_pc_rebuild = PETSC_TRUE; /* G (and M) were formed on another geometry */
+	}
+	else if( bsscrp->do_scaling && BSSCR_StokesSchurPCReuseKVersion( Solver ) != Solver->schur_pc_kVersion ) {
+		Solver->schur_pc_rebuild = PETSC_TRUE; /* formed under the scaling of a previous K */
+	}
+
 
 	/* 1. define S pc to be "none" */
 
@@ -180,7 +384,7 @@ PetscErrorCode BSSCR_BSSCR_StokesCreatePCSchur2(
 
 		if (!Smat) {	Stg_SETERRQ(1,"Smat cannot be NULL if -Q22_pc_type = uwscale");	}
 
-		BSSCR_FormSchurApproximation1( K, G, D, C, &Shat, sym );
+		BSSCR_StokesSchurPCReuseShat( pc_type, BSSCR_FormSchurApproximation1, K, G, D, C, &Shat, sym, Solver );
 
 		Stg_PCGetOperators( pc_S, &Amat, &Pmat, &mstruct );
 		Stg_PCSetOperators( pc_S, Amat, Shat, SAME_NONZERO_PATTERN );
@@ -195,7 +399,7 @@ PetscErrorCode BSSCR_BSSCR_StokesCreatePCSchur2(
 
 		if (!Smat) {	Stg_SETERRQ(1,"Smat cannot be NULL if -Q22_pc_type = uwscale");	}
 
-		BSSCR_FormSchurApproximationDiag( K, G, D, C, &Shat, sym );
+		BSSCR_StokesSchurPCReuseShat( pc_type, BSSCR_FormSchurApproximationDiag, K, G, D, C, &Shat, sym, Solver );
 
 		Stg_PCGetOperators( pc_S, &Amat, &Pmat, &mstruct );
 		Stg_PCSetOperators( pc_S, Amat, Shat, SAME_NONZERO_PATTERN );
@@ -208,13 +412,22 @@ PetscErrorCode BSSCR_BSSCR_StokesCreatePCSchur2(
 	    /* Build the schur pc GtKG */
 	    PCSetType( pc_S, "gtkg" );
 	    //AugLagStokes_SLE * stokesSLE = (AugLagStokes_SLE*)bsscrp->st_sle;
-        StokesBlockKSPInterface* Solver = bsscrp->solver;
 	    Mat M=0;
 	    if (Solver->vmStiffMat){
 		M = Solver->vmStiffMat->matrix;
 	    }
 	    BSSCR_PCGtKGSet_Operators( pc_S, K, G, M );
 	    //BSSCR_PCGtKGAttachNullSpace( pc_S );
+
+	    if( reuse ) {
+		if( Solver->Shat_reuse ) Stg_MatDestroy( &Solver->Shat_reuse );
+		/* hand the retained G^T G ksp to the new pc; it checks the sizes itself during setup */
+		if( Solver->ksp_GtG_reuse && !Solver->schur_pc_rebuild ) {
+		    PetscObjectReference( (PetscObject)Solver->ksp_GtG_reuse );
+		    BSSCR_PCGtKGSet_KSP( pc_S, Solver->ksp_GtG_reuse );
+		    BSSCR_PCGtKGSet_ReuseOperator( pc_S, PETSC_TRUE );
+		}
+	    }
 	}
 	else { /* not valid option */
 		Stg_SETERRQ( PETSC_ERR_SUP, "OPTION: -Q22_pc_type is not valid" );
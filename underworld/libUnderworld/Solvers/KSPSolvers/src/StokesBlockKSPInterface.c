@@ -59,7 +59,7 @@ void* _StokesBlockKSPInterface_DefaultNew( Name name ) {
     Stg_Component_BuildFunction*                            _build = _StokesBlockKSPInterface_Build;
     Stg_Component_InitialiseFunction*                  _initialise = _StokesBlockKSPInterface_Initialise;
     Stg_Component_ExecuteFunction*                        _execute = _SLE_Solver_Execute;
-    Stg_Component_DestroyFunction*                        _destroy = _SLE_Solver_Destroy;
+    Stg_Component_DestroyFunction*                        _destroy = _StokesBlockKSPInterface_Destroy;
     SLE_Solver_GetResidualFunc*                       _getResidual = NULL;
     Stg_Component_DefaultConstructorFunction*  _defaultConstructor = _StokesBlockKSPInterface_DefaultNew;
     Stg_Component_ConstructFunction*                    _construct = _StokesBlockKSPInterface_AssignFromXML;
@@ -206,6 +206,16 @@ void _StokesBlockKSPInterface_Initialise( void* solver, void* data ) {
 	KSPRegisterAllKSP("Solvers/KSPSolvers/src");
 }
 
+void _StokesBlockKSPInterface_Destroy( void* solver, void* data ) {
+	StokesBlockKSPInterface* self = (StokesBlockKSPInterface*) solver;
+
+	/* release any Schur preconditioner retained between solves */
+	if( self->Shat_reuse )    Stg_MatDestroy( &self->Shat_reuse );
+	if( self->ksp_GtG_reuse ) Stg_KSPDestroy( &self->ksp_GtG_reuse );
+
+	_SLE_Solver_Destroy( self, data );
+}
+
 /* SolverSetup */
 
 void _StokesBlockKSPInterface_SolverSetup( void* solver, void* stokesSLE ) {
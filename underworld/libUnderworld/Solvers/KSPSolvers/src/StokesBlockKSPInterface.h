@@ -34,6 +34,10 @@
                 double vmin, vmax;                   \
                 double pmin, pmax;                   \
                 double p_sum;                        \
+                int schur_pc_rebuilds; /** Schur pc reuse (-Q22_pc_reuse): counts accumulate across solves **/ \
+                int schur_pc_reuses; \
+                double schur_pc_setup_time; /** time taken by the most recent rebuild **/ \
+                double schur_pc_time_saved; \
 
         struct STATS { __STATS };
         typedef struct STATS STATS;
@@ -67,6 +71,14 @@
         Name optionsFile;                                        \
         char * optionsString;  \
         int fhat_reason, backsolve_reason, outer_reason; \
+        /* Schur pc retained between solves when -Q22_pc_reuse is set */ \
+        Mat Shat_reuse; /* uwscale, gkgdiag */ \
+        KSP ksp_GtG_reuse; /* gtkg: inner ksp holding G^T G */ \
+        PetscTruth schur_pc_reuse, schur_pc_rebuild, schur_pc_rebuilt; \
+        int schur_pc_ref_its; \
+        void* schur_pc_mesh; /* mesh, and its geometryVersion, G and M were assembled on */ \
+        unsigned schur_pc_meshVersion; \
+        unsigned schur_pc_kVersion; /* K assemblyVersion the equation scaling was built from */ \
 
 	struct StokesBlockKSPInterface { __StokesBlockKSPInterface };
 
@@ -122,7 +134,7 @@
 
 	void _StokesBlockKSPInterface_Initialise( void* solver, void* stokesSLE ) ;
 
-        /* void _StokesBlockKSPInterface_Destroy( void* solver, void* data ); */
+	void _StokesBlockKSPInterface_Destroy( void* solver, void* data );
 
 	void _StokesBlockKSPInterface_SolverSetup( void* stokesSle, void* stokesSLE );
     void _StokesBlockKSPInterface_Solve( void* solver, void* stokesSLE );
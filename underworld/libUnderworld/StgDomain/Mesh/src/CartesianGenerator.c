@@ -120,6 +120,7 @@ void _CartesianGenerator_Init( CartesianGenerator* self ) {
 	self->comm = NULL;
 	self->regular = True;
 	memset( self->periodic, 0, 3 * sizeof(Bool) );
+	self->implicitIncidence = True;
 	self->maxDecompDims = 0;
 	self->minDecomp = NULL;
 	self->maxDecomp = NULL;
@@ -315,6 +316,9 @@ void _CartesianGenerator_AssignFromXML( void* meshGenerator, Stg_ComponentFactor
 	self->periodic[1] = Stg_ComponentFactory_GetBool( cf, self->name, (Dictionary_Entry_Key)"periodic_y", False  );
 	self->periodic[2] = Stg_ComponentFactory_GetBool( cf, self->name, (Dictionary_Entry_Key)"periodic_z", False  );
 
+	/* Read implicit incidence flag. */
+	self->implicitIncidence = Stg_ComponentFactory_GetBool( cf, self->name, (Dictionary_Entry_Key)"implicitIncidence", True  );
+
 	/* Free stuff. */
 	FreeArray( size );
 }
@@ -551,6 +555,11 @@ void _CartesianGenerator_GenVertices( void* meshGenerator, IGraph* topo, Grid***
 	/*@
 		Performs parallel initialisation of 'topo' vertex grid
 
+		Vertices on the boundary between two sub-domains are owned by the
+		sub-domain with the lower rank, which for the lexicographic processor
+		grid is the case whenever a vertex lies on the lower face of this
+		sub-domain in some decomposed dimension. Ownership is therefore known
+		without exchanging vertex lists with the neighbours.
 		@*/
 	CartesianGenerator*	self = (CartesianGenerator*)meshGenerator;
 	Stream*			stream = Journal_Register( Info_Type, (Name)self->type  );
@@ -559,7 +568,7 @@ void _CartesianGenerator_GenVertices( void* meshGenerator, IGraph* topo, Grid***
 	Grid*			grid;
 	unsigned		local_vert_num; /* local number of vertices */
 	unsigned		nLocals, *locals;
-	unsigned		nRemotes;
+	unsigned		nRemotes, *remotes;
 	unsigned		*dimInds, *rankInds;
 	unsigned		d_i, e_i;
 
@@ -583,29 +592,41 @@ void _CartesianGenerator_GenVertices( void* meshGenerator, IGraph* topo, Grid***
 	for( d_i = 1; d_i < grid->nDims; d_i++ )
 		local_vert_num *= grid->sizes[d_i];
 	locals = Memory_Alloc_Array_Unnamed( unsigned, local_vert_num );
+	remotes = Memory_Alloc_Array_Unnamed( unsigned, local_vert_num );
 
 	dimInds = Memory_Alloc_Array_Unnamed( unsigned, self->elGrid->nDims );
 	rankInds = Memory_Alloc_Array_Unnamed( unsigned, self->elGrid->nDims );
 	Grid_Lift( self->procGrid, rank, rankInds );
 
-	/* calculate local vertex grid position */
+	/* calculate local vertex grid position, walking the local grid in global
+	   order so both lists come out sorted */
 	nLocals = 0;
 	nRemotes = 0;
 	for( e_i = 0; e_i < local_vert_num; e_i++ ) {
+		Bool	owned = True;
+
 		/* calculate local grid position -> dimInds */
 		Grid_Lift( grid, e_i, dimInds );
 
-		/* offset dimInds by the processor's vertex origin */
-		for( d_i = 0; d_i < grid->nDims; d_i++ )
+		/* vertices on a lower sub-domain face belong to the lower rank */
+		for( d_i = 0; d_i < grid->nDims; d_i++ ) {
+			if( dimInds[d_i] == 0 && rankInds[d_i] > 0 )
+				owned = False;
 			dimInds[d_i] += self->vertOrigin[d_i];
+		}
 
 		/* calculate the global grid node Id for given vertex */
-		locals[(nLocals)++] = Grid_Project( globalGrid, dimInds );
+		if( owned )
+			locals[nLocals++] = Grid_Project( globalGrid, dimInds );
+		else
+			remotes[nRemotes++] = Grid_Project( globalGrid, dimInds );
 	}
 
 	/* save locals information on topo */
-	IGraph_SetElements( topo, 0, nLocals, locals );
+	IGraph_SetLocalElements( topo, 0, nLocals, locals );
+	IGraph_SetRemoteElements( topo, 0, nRemotes, remotes );
 	FreeArray( locals );
+	FreeArray( remotes );
 	FreeArray( dimInds );
 	FreeArray( rankInds );
 	FreeObject( grid );
@@ -1276,6 +1297,8 @@ void CartesianGenerator_BuildDecomp( CartesianGenerator* self ) {
 	double		bestRatio;
 	unsigned	bestPos;
 	unsigned	*myRankInds, *rankInds;
+	unsigned	*nbrOrigin, *nbrRange;
+	Grid*		nbrGrid;
 	unsigned	nNbrs, *nbrs;
 	unsigned	p_i, d_i, r_i;
    Stream*  errorStream = Journal_Register( Error_Type, (Name)self->type  );
@@ -1372,29 +1395,34 @@ void CartesianGenerator_BuildDecomp( CartesianGenerator* self ) {
 		self->vertRange[d_i] = self->range[d_i] + 1;
 	}
 
-	/* Build the comm topology. */
+	/* Build the comm topology. The neighbours are the sub-domains at most one
+	   step away in each dimension of the processor grid, visited in rank
+	   order so there's no need to test every rank. */
 	myRankInds = AllocArray( unsigned, Grid_GetNumDims( self->procGrid ) );
 	rankInds = AllocArray( unsigned, Grid_GetNumDims( self->procGrid ) );
+	nbrOrigin = AllocArray( unsigned, Grid_GetNumDims( self->procGrid ) );
+	nbrRange = AllocArray( unsigned, Grid_GetNumDims( self->procGrid ) );
 	Grid_Lift( self->procGrid, rank, myRankInds );
+	for( d_i = 0; d_i < Grid_GetNumDims( self->procGrid ); d_i++ ) {
+		nbrOrigin[d_i] = (myRankInds[d_i] > 0) ? myRankInds[d_i] - 1 : 0;
+		nbrRange[d_i] = (myRankInds[d_i] < self->procGrid->sizes[d_i] - 1) ? myRankInds[d_i] + 2 : myRankInds[d_i] + 1;
+		nbrRange[d_i] -= nbrOrigin[d_i];
+	}
+	nbrGrid = Grid_New();
+	Grid_SetNumDims( nbrGrid, Grid_GetNumDims( self->procGrid ) );
+	Grid_SetSizes( nbrGrid, nbrRange );
 	nNbrs = 0;
-	nbrs = NULL;
-	for( r_i = 0; r_i < Grid_GetNumPoints( self->procGrid ); r_i++ ) {
-		if( r_i == rank )
-			continue;
-
-		Grid_Lift( self->procGrid, r_i, rankInds );
-		for( d_i = 0; d_i < Grid_GetNumDims( self->procGrid ); d_i++ ) {
-			if( (myRankInds[d_i] > 0 && rankInds[d_i] < myRankInds[d_i] - 1) || 
-			    (myRankInds[d_i] < self->procGrid->sizes[d_i] - 1 && rankInds[d_i] > myRankInds[d_i] + 1) )
-			{
-				break;
-			}
-		}
-		if( d_i == Grid_GetNumDims( self->procGrid ) ) {
-			nbrs = ReallocArray( nbrs, unsigned, nNbrs + 1 );
-			nbrs[nNbrs++] = r_i;
-		}
+	nbrs = AllocArray( unsigned, Grid_GetNumPoints( nbrGrid ) );
+	for( r_i = 0; r_i < Grid_GetNumPoints( nbrGrid ); r_i++ ) {
+		Grid_Lift( nbrGrid, r_i, rankInds );
+		for( d_i = 0; d_i < Grid_GetNumDims( self->procGrid ); d_i++ )
+			rankInds[d_i] += nbrOrigin[d_i];
+		if( Grid_Project( self->procGrid, rankInds ) != rank )
+			nbrs[nNbrs++] = Grid_Project( self->procGrid, rankInds );
 	}
+	FreeObject( nbrGrid );
+	FreeArray( nbrOrigin );
+	FreeArray( nbrRange );
 
 	FreeArray( myRankInds );
 	FreeArray( rankInds );
@@ -1475,6 +1503,7 @@ void CartesianGenerator_RecurseDecomps( CartesianGenerator* self,
 void CartesianGenerator_GenTopo( CartesianGenerator* self, IGraph* topo ) {
 	Grid***		grids;
 	const Comm* comm;
+	Bool		shadows;
 	unsigned	d_i, d_j;
 
 	assert( self );
@@ -1562,6 +1591,23 @@ void CartesianGenerator_GenTopo( CartesianGenerator* self, IGraph* topo ) {
 		}
 	}
 
+	/* When only vertices and elements are in use the shadows can be added from
+	   the structured layout before any incidence is generated, so the shadow
+	   incidence is generated along with the local incidence. Otherwise fall back
+	   to the generic shadowing below. */
+	comm = MeshTopology_GetComm( topo );
+	shadows = self->shadowDepth && Comm_GetNumNeighbours( comm ) > 0;
+	if( shadows && self->enabledDims[0] && self->enabledDims[self->nDims] && self->enabledInc[self->nDims][0] ) {
+		for( d_i = 1; d_i < self->nDims; d_i++ ) {
+			if( self->enabledDims[d_i] )
+				break;
+		}
+		if( d_i == self->nDims ) {
+			CartesianGenerator_GenShadows( self, topo );
+			shadows = False;
+		}
+	}
+
 	/* Generate topological incidence. */
 	if( self->enabledInc[self->nDims][0] )
 		CartesianGenerator_GenElementVertexInc( self, topo, grids );
@@ -1581,8 +1627,7 @@ void CartesianGenerator_GenTopo( CartesianGenerator* self, IGraph* topo ) {
 	}
 
 	/* Set the shadow depth and correct incidence. */
-	comm = MeshTopology_GetComm( topo );
-	if( self->shadowDepth && Comm_GetNumNeighbours( comm ) > 0 ) {
+	if( shadows ) {
 		/* Build enough incidence to set shadow depth. */
 		IGraph_InvertIncidence( topo, MT_VERTEX, topo->nDims );
 		IGraph_ExpandIncidence( topo, topo->nDims );
@@ -1617,6 +1662,23 @@ void CartesianGenerator_GenTopo( CartesianGenerator* self, IGraph* topo ) {
 	/* Generate any boundary elements required. */
 	CartesianGenerator_GenBndVerts( self, topo, grids );
 
+	/* The element to vertex lists follow from the grids, so swap them for the implicit
+	   form, which keeps only a map of the domain vertices. Everything above needs the
+	   explicit lists, so this saves memory for the life of the mesh but not at its peak. */
+	if( self->implicitIncidence && self->enabledInc[self->nDims][0] ) {
+		int	elSizes[3];
+		int	step;
+
+		step = (self->vertGrid->sizes[0] - 1) / self->elGrid->sizes[0];
+		for( d_i = 0; d_i < self->nDims; d_i++ ) {
+			elSizes[d_i] = self->elGrid->sizes[d_i];
+			if( (int)self->vertGrid->sizes[d_i] != step * elSizes[d_i] + 1 )
+				break;
+		}
+		if( d_i == self->nDims && step > 0 )
+			IGraph_SetImplicitIncidence( topo, elSizes, step );
+	}
+
 	/* Free allocated grids. */
 	grids[topo->nDims][0] = NULL;
 	for( d_i = 1; d_i < topo->nDims; d_i++ ) {
@@ -1805,6 +1867,93 @@ void CartesianGenerator_GenEdges3D( CartesianGenerator* self, IGraph* topo, Grid
 	FreeObject( globalGrid );
 }
 
+void CartesianGenerator_GenShadows( CartesianGenerator* self, IGraph* topo ) {
+	/*@
+		Adds the shadow elements and vertices to topo directly from the structured
+		layout. The shadow elements are those of other sub-domains within shadowDepth
+		layers of this sub-domain, ie. the local element block grown by shadowDepth
+		elements on each side, and the shadow vertices are their vertices which are
+		not already in the domain. These are the same layers the generic IGraph
+		shadowing builds, without needing any incidence or exchanges.
+		@*/
+	Grid*		grid;
+	unsigned	nDims;
+	unsigned	*lower, *upper, *sizes, *steps, *inds;
+	unsigned	nShds, *shds;
+	unsigned	s_i, d_i;
+
+	assert( self );
+	assert( topo );
+
+	nDims = self->elGrid->nDims;
+	lower = AllocArray( unsigned, nDims );
+	upper = AllocArray( unsigned, nDims );
+	sizes = AllocArray( unsigned, nDims );
+	steps = AllocArray( unsigned, nDims );
+	inds = AllocArray( unsigned, nDims );
+	for( d_i = 0; d_i < nDims; d_i++ ) {
+		lower[d_i] = (self->origin[d_i] > self->shadowDepth) ? self->origin[d_i] - self->shadowDepth : 0;
+		upper[d_i] = self->origin[d_i] + self->range[d_i] + self->shadowDepth;
+		if( upper[d_i] > self->elGrid->sizes[d_i] )
+			upper[d_i] = self->elGrid->sizes[d_i];
+		/* vertices per element step, 1 for linear and 2 for quadratic grids */
+		steps[d_i] = (self->vertGrid->sizes[d_i] - 1) / self->elGrid->sizes[d_i];
+	}
+	grid = Grid_New();
+	Grid_SetNumDims( grid, nDims );
+
+	/* Shadow elements, in global order. */
+	for( d_i = 0; d_i < nDims; d_i++ )
+		sizes[d_i] = upper[d_i] - lower[d_i];
+	Grid_SetSizes( grid, sizes );
+	nShds = 0;
+	shds = AllocArray( unsigned, Grid_GetNumPoints( grid ) );
+	for( s_i = 0; s_i < Grid_GetNumPoints( grid ); s_i++ ) {
+		Bool	local = True;
+
+		Grid_Lift( grid, s_i, inds );
+		for( d_i = 0; d_i < nDims; d_i++ ) {
+			inds[d_i] += lower[d_i];
+			if( inds[d_i] < self->origin[d_i] || inds[d_i] >= self->origin[d_i] + self->range[d_i] )
+				local = False;
+		}
+		if( !local )
+			shds[nShds++] = Grid_Project( self->elGrid, inds );
+	}
+	IGraph_AddRemoteElements( topo, nDims, nShds, shds );
+	FreeArray( shds );
+
+	/* Shadow vertices, in global order. */
+	for( d_i = 0; d_i < nDims; d_i++ )
+		sizes[d_i] = (upper[d_i] - lower[d_i]) * steps[d_i] + 1;
+	Grid_SetSizes( grid, sizes );
+	nShds = 0;
+	shds = AllocArray( unsigned, Grid_GetNumPoints( grid ) );
+	for( s_i = 0; s_i < Grid_GetNumPoints( grid ); s_i++ ) {
+		Bool	domain = True;
+
+		Grid_Lift( grid, s_i, inds );
+		for( d_i = 0; d_i < nDims; d_i++ ) {
+			inds[d_i] += lower[d_i] * steps[d_i];
+			if( inds[d_i] < self->vertOrigin[d_i] || inds[d_i] >= self->vertOrigin[d_i] + self->vertRange[d_i] )
+				domain = False;
+		}
+		if( !domain )
+			shds[nShds++] = Grid_Project( self->vertGrid, inds );
+	}
+	IGraph_AddRemoteElements( topo, 0, nShds, shds );
+	FreeArray( shds );
+
+	_MeshTopology_SetShadowDepth( topo, self->shadowDepth );
+
+	FreeObject( grid );
+	FreeArray( lower );
+	FreeArray( upper );
+	FreeArray( sizes );
+	FreeArray( steps );
+	FreeArray( inds );
+}
+
 void CartesianGenerator_GenBndVerts( CartesianGenerator* self, IGraph* topo, Grid*** grids ) {
 	/*@
 		Builds an int array on topo->nBndEls[0]. These integers represent the domain (local+shadow) nodes
@@ -54,6 +54,7 @@
 		Comm*		comm;								\
 		Bool		regular;							\
 		Bool		periodic[3];							\
+		Bool		implicitIncidence;	/* Answer element to vertex incidence from the grids */ \
 		unsigned	maxDecompDims;							\
 		unsigned*	minDecomp;							\
 		unsigned*	maxDecomp;							\
@@ -194,6 +195,7 @@
 	void CartesianGenerator_GenTopo( CartesianGenerator* self, IGraph* topo );
 	void CartesianGenerator_GenEdges2D( CartesianGenerator* self, IGraph* topo, Grid*** grids );
 	void CartesianGenerator_GenEdges3D( CartesianGenerator* self, IGraph* topo, Grid*** grids );
+	void CartesianGenerator_GenShadows( CartesianGenerator* self, IGraph* topo );
 	void CartesianGenerator_GenBndVerts( CartesianGenerator* self, IGraph* topo, Grid*** grids );
 	void CartesianGenerator_CompleteVertexNeighbours( CartesianGenerator* self, IGraph* topo, Grid*** grids );
 	void CartesianGenerator_MapToDomain( CartesianGenerator* self, Sync* sync, 
@@ -17,6 +17,11 @@
 
 void Decomp_Update( Decomp* self );
 void Decomp_UpdateOwnerMap( Decomp* self );
+void Decomp_UpdateInverse( Decomp* self );
+
+
+/* Runs of consecutive globals shorter than this are kept in the hash map. */
+static const int Decomp_MinRunSize = 4;
 
 
 int stgCmpIntNE( const void* l, const void* r ) {
@@ -24,6 +29,26 @@ int stgCmpIntNE( const void* l, const void* r ) {
    return (*(int*)l < *(int*)r) ? -1 : 1;
 }
 
+/* Returns the run holding 'global', or NULL if it's not in one. */
+static const int* Decomp_FindRun( const Decomp* self, int global ) {
+   const int* run;
+   int lower, upper, mid;
+
+   if( !self->nRuns )
+      return NULL;
+   lower = 0;
+   upper = self->nRuns;
+   while( upper - lower > 1 ) {
+      mid = (lower + upper) / 2;
+      if( global < self->runs[3 * mid] )
+         upper = mid;
+      else
+         lower = mid;
+   }
+   run = self->runs + 3 * lower;
+   return (global >= run[0] && global < run[0] + run[2]) ? run : NULL;
+}
+
 
 const Type Decomp_Type = "Decomp";
 
@@ -60,12 +85,15 @@ void _Decomp_Init( void* _self ) {
    self->nGlobals = 0;
    self->locals = &self->localsObj;
    IArray_Init( self->locals );
+   self->nRuns = 0;
+   self->runs = NULL;
    self->inv = &self->invObj;
    IMap_Init( self->inv );
    self->rngBegin = 0;
    self->rngEnd = 0;
    self->owners = &self->ownersObj;
    IMap_Init( self->owners );
+   self->ownersValid = False;
 }
 
 void Decomp_Destruct( Decomp* _self ) {
@@ -73,6 +101,7 @@ void Decomp_Destruct( Decomp* _self ) {
 
    Decomp_Clear( self );
    IArray_Destruct( self->locals );
+   KillArray( self->runs );
    IMap_Destruct( self->inv );
    IMap_Destruct( self->owners );
 }
@@ -92,7 +121,8 @@ void Decomp_Copy( void* _self, const void* _op ) {
    self->mpiComm = op->mpiComm;
    self->nGlobals = op->nGlobals;
    IArray_Copy( self->locals, op->locals );
-   IMap_Copy( self->inv, op->inv );
+   Decomp_UpdateInverse( self );
+   self->ownersValid = False;
 }
 
 /*
@@ -118,41 +148,29 @@ void Decomp_SetMPIComm( void* _self, MPI_Comm mpiComm ) {
 
 void Decomp_SetLocals( void* _self, int nLocals, const int* locals ) {
    Decomp* self = (Decomp*)_self;
-   int l_i;
 
    assert( self && (!nLocals || locals) );
    IArray_Set( self->locals, nLocals, locals );
    Decomp_Update( self );
-   IMap_Clear( self->inv );
-   IMap_SetMaxSize( self->inv, nLocals );
-   for( l_i = 0; l_i < nLocals; l_i++ )
-      IMap_Insert( self->inv, locals[l_i], l_i );
+   Decomp_UpdateInverse( self );
 }
 
 void Decomp_AddLocals( void* _self, int nLocals, const int* locals ) {
    Decomp* self = (Decomp*)_self;
-   int l_i;
 
    assert( self && (!nLocals || locals) );
-   IMap_SetMaxSize( self->inv, IArray_GetSize( self->locals ) + nLocals );
    IArray_Add( self->locals, nLocals, locals );
    Decomp_Update( self );
-   for( l_i = 0; l_i < nLocals; l_i++ )
-      IMap_Insert( self->inv, locals[l_i], l_i );
+   Decomp_UpdateInverse( self );
 }
 
 void Decomp_RemoveLocals( void* _self, int nLocals, const int* locals, IMap* map ) {
    Decomp* self = (Decomp*)_self;
-   int oldSize;
-   int l_i;
 
    assert( self && (!nLocals || locals) );
-   oldSize = IArray_GetSize( self->locals );
    IArray_Remove( self->locals, nLocals, locals, map );
    Decomp_Update( self );
-   for( l_i = 0; l_i < nLocals; l_i++ )
-      IMap_Remove( self->inv, locals[l_i] );
-   IMap_SetMaxSize( self->inv, oldSize - nLocals );
+   Decomp_UpdateInverse( self );
 }
 
 void Decomp_Clear( void* _self ) {
@@ -168,10 +186,12 @@ void Decomp_ClearLocals( void* _self ) {
 
    assert( self );
    IArray_Clear( self->locals );
+   self->nRuns = 0;
    IMap_Clear( self->inv );
    self->rngBegin = 0;
    self->rngEnd = 0;
    IMap_Clear( self->owners );
+   self->ownersValid = False;
 }
 
 MPI_Comm Decomp_GetComm( const void* self ) {
@@ -205,15 +225,64 @@ int Decomp_LocalToGlobal( const void* self, int local ) {
 }
 
 int Decomp_GlobalToLocal( const void* self, int global ) {
+   const int* run;
+
    assert( self && global < ((Decomp*)self)->nGlobals );
+   run = Decomp_FindRun( (Decomp*)self, global );
+   if( run )
+      return run[1] + global - run[0];
    return IMap_Map( ((Decomp*)self)->inv, global );
 }
 
 Bool Decomp_TryGlobalToLocal( const void* self, int global, int* local ) {
+   const int* run;
+
    assert( self && global < ((Decomp*)self)->nGlobals );
+   run = Decomp_FindRun( (Decomp*)self, global );
+   if( run ) {
+      *local = run[1] + global - run[0];
+      return True;
+   }
    return IMap_TryMap( ((Decomp*)self)->inv, global, local );
 }
 
+/* Maps each of 'inds' from global to local in place. Each must be local. Runs
+   of neighbouring globals, as are common in the shadow lists, reuse the last
+   run found without searching again. */
+void Decomp_GlobalsToLocals( const void* _self, int nInds, int* inds ) {
+   const Decomp* self = (Decomp*)_self;
+   const int* run = NULL;
+   int global;
+   int i_i;
+
+   assert( self && (!nInds || inds) );
+   for( i_i = 0; i_i < nInds; i_i++ ) {
+      global = inds[i_i];
+      assert( global < self->nGlobals );
+      if( !run || global < run[0] || global >= run[0] + run[2] )
+         run = Decomp_FindRun( self, global );
+      inds[i_i] = run ? run[1] + global - run[0] : IMap_Map( self->inv, global );
+   }
+}
+
+/* Returns the bytes held by the global to local map. */
+SizeT Decomp_GetInverseMemory( const void* _self ) {
+   const Decomp* self = (Decomp*)_self;
+   SizeT mem;
+   int nChained, t_i;
+
+   assert( self );
+   nChained = self->inv->curSize;
+   for( t_i = 0; t_i < self->inv->tblSize; t_i++ ) {
+      if( self->inv->used[t_i] )
+         nChained--;
+   }
+   mem = 3 * self->nRuns * sizeof(int);
+   mem += self->inv->tblSize * (sizeof(IMapItem) + sizeof(Bool));
+   mem += nChained * sizeof(IMapItem);
+   return mem;
+}
+
 void Decomp_FindOwners( const void* _self, int nGlobals, const int* globals, 
 		       int* ranks )
 {
@@ -231,6 +300,11 @@ void Decomp_FindOwners( const void* _self, int nGlobals, const int* globals,
    assert( !nGlobals || globals );
    assert( !nGlobals || ranks );
 
+   /* The owner directory is only built once it's needed, as it requires an
+      exchange with every rank. */
+   if( !self->ownersValid )
+      Decomp_UpdateOwnerMap( (Decomp*)self );
+
    insist( MPI_Comm_size( self->mpiComm, &nRanks ), == MPI_SUCCESS );
    insist( MPI_Comm_rank( self->mpiComm, &rank ), == MPI_SUCCESS );
 
@@ -327,7 +401,9 @@ void Decomp_Update( Decomp* self ) {
    else
       self->nGlobals = 0;
 
-   Decomp_UpdateOwnerMap( self );
+   /* Invalidate the owner directory, it's rebuilt by Decomp_FindOwners. */
+   IMap_Clear( self->owners );
+   self->ownersValid = False;
 }
 
 void Decomp_UpdateOwnerMap( Decomp* self ) {
@@ -408,6 +484,47 @@ void Decomp_UpdateOwnerMap( Decomp* self ) {
    }
    MemFree( recvSizes );
    MemFree( recvArrays );
+   self->ownersValid = True;
 }
 
+void Decomp_UpdateInverse( Decomp* self ) {
+   int nLocals;
+   const int *locals;
+   int nScattered, len;
+   int *run;
+   int l_i, i_i;
+
+   assert( self );
+   IArray_GetArray( self->locals, &nLocals, &locals );
+
+   /* Count the runs, then store them and hash the rest. */
+   self->nRuns = 0;
+   nScattered = 0;
+   for( l_i = 0; l_i < nLocals; l_i += len ) {
+      for( len = 1; l_i + len < nLocals && locals[l_i + len] == locals[l_i + len - 1] + 1; len++ );
+      if( len >= Decomp_MinRunSize )
+         self->nRuns++;
+      else
+         nScattered += len;
+   }
+   self->runs = ReallocArray( self->runs, int, 3 * self->nRuns );
+   IMap_Clear( self->inv );
+   IMap_SetMaxSize( self->inv, nScattered );
+
+   run = self->runs;
+   for( l_i = 0; l_i < nLocals; l_i += len ) {
+      for( len = 1; l_i + len < nLocals && locals[l_i + len] == locals[l_i + len - 1] + 1; len++ );
+      if( len >= Decomp_MinRunSize ) {
+         run[0] = locals[l_i];
+         run[1] = l_i;
+         run[2] = len;
+         run += 3;
+      }
+      else {
+         for( i_i = l_i; i_i < l_i + len; i_i++ )
+            IMap_Insert( self->inv, locals[i_i], i_i );
+      }
+   }
+   qsort( self->runs, self->nRuns, 3 * sizeof(int), stgCmpIntNE );
+}
 
@@ -19,12 +19,20 @@ extern const Type Decomp_Type;
     int nGlobals;                              \
     IArray* locals;                            \
     IArray localsObj;                          \
+    int nRuns;                                 \
+    int* runs;                                 \
     IMap* inv;                                 \
     IMap invObj;                               \
     int rngBegin;                              \
     int rngEnd;                                \
     IMap* owners;                              \
-    IMap ownersObj;
+    IMap ownersObj;                            \
+    Bool ownersValid;
+
+/* The global to local map is held as the runs of locals with consecutive
+   global indices, each as (first global, first local, size) sorted by the
+   first global and searched by bisection, with the remaining locals in the
+   hash map 'inv'. */
 
 struct Decomp { __Decomp };
 
@@ -80,6 +88,10 @@ int Decomp_GlobalToLocal( const void* self, int global );
 
 Bool Decomp_TryGlobalToLocal( const void* self, int global, int* local );
 
+void Decomp_GlobalsToLocals( const void* self, int nInds, int* inds );
+
+SizeT Decomp_GetInverseMemory( const void* self );
+
 void Decomp_FindOwners( const void* _self, int nGlobals, const int* globals, 
                         int* ranks );
 
@@ -87,4 +99,6 @@ void Decomp_Update( Decomp* self );
 
 void Decomp_UpdateOwnerMap( Decomp* self );
 
+void Decomp_UpdateInverse( Decomp* self );
+
 #endif /* __StgDomain_Mesh_Decomp_h__ */
@@ -23,6 +23,14 @@ const Type IGraph_Type = "IGraph";
 void IGraph_PickleIncidenceInit( IGraph* self, int dim, int nEls, int* els, int* nBytes );
 void IGraph_PickleIncidence( IGraph* self, int dim, int nEls, int* els, stgByte* bytes );
 void IGraph_UnpickleIncidence( IGraph* self, int dim, int nBytes, stgByte* bytes );
+void IGraph_AllocIncidence( IGraph* self, int fromDim, int toDim, int maxSize );
+void IGraph_ResizeIncidence( IGraph* self, int fromDim, int toDim, int nKeep, int nEls );
+void IGraph_FreeIncidence( IGraph* self, int fromDim, int toDim );
+void IGraph_RepackIncidence( IGraph* self, int fromDim, int toDim, int maxSize );
+int* IGraph_ReserveIncidence( IGraph* self, int fromDim, int fromEl, int toDim, int nIncEls );
+Bool IGraph_IsImplicit( const IGraph* self, int fromDim, int toDim );
+void IGraph_ImplicitList( const IGraph* self, const IGraph_ImplicitIncidence* impl, int fromEl, int* list );
+void IGraph_FreeImplicit( IGraph* self );
 int IGraph_Cmp( const void* l, const void* r );
 
 
@@ -70,6 +78,8 @@ void _IGraph_Init( void* _self ) {
     self->bndEls = NULL;
     self->nIncEls = NULL;
     self->incEls = NULL;
+    self->incPacks = NULL;
+    self->implicitInc = NULL;
 }
 
 void IGraph_Destruct( IGraph* self ) {
@@ -121,6 +131,7 @@ void _IGraph_SetNumDims( void* _self, int nDims ) {
     self->remotes = AllocArray( Sync*, self->nTDims );
     self->nIncEls = AllocArray2D( int*, self->nTDims, self->nTDims );
     self->incEls = AllocArray2D( int**, self->nTDims, self->nTDims );
+    self->incPacks = AllocArray2D( IGraph_Incidence, self->nTDims, self->nTDims );
 
     for( d_i = 0; d_i < self->nTDims; d_i++ ) {
         self->locals[d_i] = Decomp_New();
@@ -137,6 +148,7 @@ void _IGraph_SetNumDims( void* _self, int nDims ) {
 
         memset( self->nIncEls[d_i], 0, sizeof(int**) * self->nTDims );
         memset( self->incEls[d_i], 0, sizeof(int***) * self->nTDims );
+        memset( self->incPacks[d_i], 0, sizeof(IGraph_Incidence) * self->nTDims );
     }
 }
 
@@ -166,6 +178,8 @@ void IGraph_SetDomain( void* _self, int dim, Sync* sync ) {
     IGraph* self = (IGraph*)_self;
 
     assert( self && dim < self->nTDims );
+    if( self->implicitInc && (dim == 0 || dim == self->nDims) )
+        IGraph_MaterialiseIncidence( self, self->nDims, 0 );
     Stg_Class_RemoveRef( self->locals[dim] );
     Stg_Class_RemoveRef( self->remotes[dim] );
     self->remotes[dim] = sync;
@@ -274,19 +288,15 @@ void IGraph_SetElements( void* _self, int dim, int nEls, const int* globals ) {
 
 void IGraph_SetLocalElements( void* _self, int dim, int nEls, const int* globals ) {
     IGraph* self = (IGraph*)_self;
-    int d_i, e_i;
+    int d_i;
 
     assert( self );
     assert( dim < self->nTDims );
     assert( !nEls || globals );
-    for( d_i = 0; d_i < self->nTDims; d_i++ ) {
-        for( e_i = 0; e_i < Sync_GetNumDomains( self->remotes[dim] ); d_i++ )
-            FreeArray( self->incEls[dim][d_i][e_i] );
-        FreeArray( self->incEls[dim][d_i] );
-        FreeArray( self->nIncEls[dim][d_i] );
-        self->incEls[dim][d_i] = NULL;
-        self->nIncEls[dim][d_i] = NULL;
-    }
+    if( self->implicitInc && dim == 0 )
+        IGraph_MaterialiseIncidence( self, self->nDims, 0 );
+    for( d_i = 0; d_i < self->nTDims; d_i++ )
+        IGraph_FreeIncidence( self, dim, d_i );
     Decomp_SetLocals( self->locals[dim], nEls, globals );
     Sync_SetDecomp( self->remotes[dim], self->locals[dim] );
 }
@@ -313,58 +323,36 @@ void IGraph_RemoveLocalElements( void* _self, int dim, int nEls, const int* glob
 
 void IGraph_SetRemoteElements( void* _self, int dim, int nEls, const int* globals ) {
     IGraph* self = (IGraph*)_self;
-    int nDoms;
-    int d_i, e_i;
+    int d_i;
 
     assert( self );
     assert( dim < self->nTDims );
     assert( !nEls || globals );
-    for( d_i = 0; d_i < self->nTDims; d_i++ ) {
-        if( self->nIncEls[dim][d_i] ) {
-            for( e_i = Decomp_GetNumLocals( self->locals[dim] ); e_i < Sync_GetNumDomains( self->remotes[dim] ); e_i++ ) {
-                FreeArray( self->incEls[dim][d_i][e_i] );
-            }
-        }
-    }
-
+    if( self->implicitInc && (dim == 0 || dim == self->nDims) )
+        IGraph_MaterialiseIncidence( self, self->nDims, 0 );
     Sync_SetRemotes( self->remotes[dim], nEls, globals );
 
+    /* Incidence of the previous remotes is discarded, local incidence is kept. */
     for( d_i = 0; d_i < self->nTDims; d_i++ ) {
-        if( self->nIncEls[dim][d_i] ) {
-            nDoms = Sync_GetNumDomains( self->remotes[dim] );
-            self->nIncEls[dim][d_i] = ReallocArray( self->incEls[dim][d_i], int, nDoms );
-            self->incEls[dim][d_i] = ReallocArray( self->incEls[dim][d_i], int*, nDoms );
-
-            for( e_i = Decomp_GetNumLocals( self->locals[dim] ); e_i < nDoms; e_i++ ) {
-                self->nIncEls[dim][d_i][e_i] = 0;
-                self->incEls[dim][d_i][e_i] = NULL;
-            }
-        }
+        IGraph_ResizeIncidence( self, dim, d_i, Decomp_GetNumLocals( self->locals[dim] ), 
+                                Sync_GetNumDomains( self->remotes[dim] ) );
     }
 }
 
 void IGraph_AddRemoteElements( void* _self, int dim, int nEls, const int* globals ) {
     IGraph* self = (IGraph*)_self;
-    int nOldDoms, nDoms;
-    int d_i, e_i;
+    int nOldDoms;
+    int d_i;
 
     assert( self );
     assert( dim < self->nTDims );
     assert( !nEls || globals );
+    if( self->implicitInc && (dim == 0 || dim == self->nDims) )
+        IGraph_MaterialiseIncidence( self, self->nDims, 0 );
     nOldDoms = Sync_GetNumDomains( self->remotes[dim] );
     Sync_AddRemotes( self->remotes[dim], nEls, globals );
-    for( d_i = 0; d_i < self->nTDims; d_i++ ) {
-        if( self->nIncEls[dim][d_i] ) {
-            nDoms = Sync_GetNumDomains( self->remotes[dim] );
-            self->nIncEls[dim][d_i] = ReallocArray( self->nIncEls[dim][d_i], int, nDoms );
-            self->incEls[dim][d_i] = ReallocArray( self->incEls[dim][d_i], int*, nDoms );
-
-            for( e_i = nOldDoms; e_i < nDoms; e_i++ ) {
-                self->nIncEls[dim][d_i][e_i] = 0;
-                self->incEls[dim][d_i][e_i] = NULL;
-            }
-        }
-    }
+    for( d_i = 0; d_i < self->nTDims; d_i++ )
+        IGraph_ResizeIncidence( self, dim, d_i, nOldDoms, Sync_GetNumDomains( self->remotes[dim] ) );
 }
 
 void IGraph_RemoveRemoteElements( void* _self, int dim, int nEls, const int* globals, IMap* map ) {
@@ -395,39 +383,161 @@ void IGraph_SetBoundaryElements( void* _self, int dim, int nEls, const int* els
 
 void IGraph_SetIncidence( void* _self, int fromDim, int fromEl, int toDim, int nIncEls, const int* incEls  ) {
     IGraph* self = (IGraph*)_self;
-    int nDoms;
+    int* dst;
 
     assert( self );
     assert( fromDim < self->nTDims && toDim < self->nTDims );
     assert( self->locals[fromDim] );
-    if( !self->nIncEls[fromDim][toDim] ) {
-        nDoms = Sync_GetNumDomains( self->remotes[fromDim] );
-        self->nIncEls[fromDim][toDim] = AllocArray( int, nDoms );
-        self->incEls[fromDim][toDim] = AllocArray( int*, nDoms );
-        memset( self->incEls[fromDim][toDim], 0, sizeof(int*) * nDoms );
+    dst = IGraph_ReserveIncidence( self, fromDim, fromEl, toDim, nIncEls );
+    if( nIncEls )
+        memcpy( dst, incEls, nIncEls * sizeof(int) );
+}
+
+void IGraph_RemoveIncidence( void* _self, int fromDim, int toDim ) {
+    IGraph* self = (IGraph*)_self;
+
+    assert( self );
+    assert( fromDim < self->nTDims );
+    assert( toDim < self->nTDims );
+
+    IGraph_FreeIncidence( self, fromDim, toDim );
+}
+
+Bool IGraph_SetImplicitIncidence( void* _self, const int* elSizes, int step ) {
+    IGraph* self = (IGraph*)_self;
+    IGraph_ImplicitIncidence* impl;
+    const Sync* elSync;
+    const Sync* vertSync;
+    int nDims, nEls;
+    int upper[3], ijk[3];
+    int global, dom, stride;
+    SizeT boxSize, explicitSize;
+    int* list;
+    Bool valid;
+    int b_i, e_i, n_i, d_i;
+
+    assert( self );
+    assert( elSizes );
+    assert( step > 0 );
+
+    nDims = self->nDims;
+    if( nDims < 1 || nDims > 3 || !self->nIncEls[nDims][0] )
+        return False;
+    elSync = self->remotes[nDims];
+    vertSync = self->remotes[0];
+    nEls = Sync_GetNumDomains( elSync );
+    if( !nEls )
+        return False;
+
+    impl = AllocArray( IGraph_ImplicitIncidence, 1 );
+    memset( impl, 0, sizeof(IGraph_ImplicitIncidence) );
+    impl->nDims = nDims;
+    impl->step = step;
+    impl->nIncEls = 1;
+    for( d_i = 0; d_i < nDims; d_i++ ) {
+        impl->elSizes[d_i] = elSizes[d_i];
+        impl->vertSizes[d_i] = step * elSizes[d_i] + 1;
+        impl->nIncEls *= step + 1;
+        impl->lower[d_i] = impl->vertSizes[d_i];
+        upper[d_i] = 0;
     }
 
-    self->nIncEls[fromDim][toDim][fromEl] = nIncEls;
-    self->incEls[fromDim][toDim][fromEl] = ReallocArray( self->incEls[fromDim][toDim][fromEl], int, nIncEls );
-    memcpy( self->incEls[fromDim][toDim][fromEl], incEls, nIncEls * sizeof(int) );
+    /* The box of vertices spanned by the domain elements. */
+    for( e_i = 0; e_i < nEls; e_i++ ) {
+        global = Sync_DomainToGlobal( elSync, e_i );
+        for( d_i = 0; d_i < nDims; d_i++ ) {
+            ijk[d_i] = step * (global % elSizes[d_i]);
+            global /= elSizes[d_i];
+            if( ijk[d_i] < impl->lower[d_i] )
+                impl->lower[d_i] = ijk[d_i];
+            if( ijk[d_i] + step > upper[d_i] )
+                upper[d_i] = ijk[d_i] + step;
+        }
+    }
+    boxSize = 1;
+    for( d_i = 0; d_i < nDims; d_i++ ) {
+        impl->sizes[d_i] = upper[d_i] - impl->lower[d_i] + 1;
+        boxSize *= impl->sizes[d_i];
+    }
+
+    /* Keep the explicit lists unless the map is smaller, eg. for an irregular decomposition. */
+    explicitSize = (SizeT)nEls * (SizeT)impl->nIncEls;
+    if( boxSize >= explicitSize ) {
+        FreeArray( impl );
+        return False;
+    }
+
+    impl->vertMap = AllocArray( int, boxSize );
+    for( b_i = 0; b_i < (int)boxSize; b_i++ ) {
+        global = 0;
+        stride = 1;
+        dom = b_i;
+        for( d_i = 0; d_i < nDims; d_i++ ) {
+            global += (impl->lower[d_i] + dom % impl->sizes[d_i]) * stride;
+            dom /= impl->sizes[d_i];
+            stride *= impl->vertSizes[d_i];
+        }
+        if( !Sync_TryGlobalToDomain( vertSync, global, &dom ) )
+            dom = -1;
+        impl->vertMap[b_i] = dom;
+    }
+    impl->offs = AllocArray( int, impl->nIncEls );
+    for( n_i = 0; n_i < impl->nIncEls; n_i++ ) {
+        impl->offs[n_i] = 0;
+        stride = 1;
+        dom = n_i;
+        for( d_i = 0; d_i < nDims; d_i++ ) {
+            impl->offs[n_i] += (dom % (step + 1)) * stride;
+            dom /= step + 1;
+            stride *= impl->sizes[d_i];
+        }
+    }
+
+    /* Only replace the explicit lists when every one is reproduced. */
+    list = AllocArray( int, impl->nIncEls );
+    valid = True;
+    for( e_i = 0; e_i < nEls && valid; e_i++ ) {
+        IGraph_ImplicitList( self, impl, e_i, list );
+        if( self->nIncEls[nDims][0][e_i] != impl->nIncEls || 
+            memcmp( list, self->incEls[nDims][0][e_i], impl->nIncEls * sizeof(int) ) )
+        {
+            valid = False;
+        }
+    }
+    FreeArray( list );
+    if( !valid ) {
+        FreeArray( impl->vertMap );
+        FreeArray( impl->offs );
+        FreeArray( impl );
+        return False;
+    }
+
+    IGraph_FreeIncidence( self, nDims, 0 );
+    self->implicitInc = impl;
+    return True;
 }
 
-void IGraph_RemoveIncidence( void* _self, int fromDim, int toDim ) {
+void IGraph_MaterialiseIncidence( void* _self, int fromDim, int toDim ) {
     IGraph* self = (IGraph*)_self;
+    IGraph_ImplicitIncidence* impl;
     int nEls;
     int e_i;
 
     assert( self );
-    assert( fromDim < self->nTDims );
-    assert( toDim < self->nTDims );
+    if( !IGraph_IsImplicit( self, fromDim, toDim ) )
+        return;
 
+    /* Detach the implicit form first, so the lists are reserved as explicit storage. */
+    impl = self->implicitInc;
+    self->implicitInc = NULL;
     nEls = Sync_GetNumDomains( self->remotes[fromDim] );
-    for( e_i = 0; e_i < nEls; e_i++ )
-        FreeArray( self->incEls[fromDim][toDim][e_i] );
-    FreeArray( self->incEls[fromDim][toDim] );
-    FreeArray( self->nIncEls[fromDim][toDim] );
-    self->incEls[fromDim][toDim] = NULL;
-    self->nIncEls[fromDim][toDim] = NULL;
+    IGraph_AllocIncidence( self, fromDim, toDim, nEls * impl->nIncEls );
+    for( e_i = 0; e_i < nEls; e_i++ ) {
+        IGraph_ImplicitList( self, impl, e_i, 
+                             IGraph_ReserveIncidence( self, fromDim, e_i, toDim, impl->nIncEls ) );
+    }
+    self->implicitInc = impl;
+    IGraph_FreeImplicit( self );
 }
 
 void IGraph_InvertIncidence( void* _self, int fromDim, int toDim ) {
@@ -435,10 +545,11 @@ void IGraph_InvertIncidence( void* _self, int fromDim, int toDim ) {
     int fromSize, toSize;
     int *nInvIncEls, **invIncEls;
     int *nIncEls, **incEls;
-    int elInd;
+    int nTotal, elInd;
     int e_i, inc_i;
 
     assert( self );
+    IGraph_MaterialiseIncidence( self, toDim, fromDim );
 
     // find the overall number of 'fromSize' topo elements
     fromSize = Sync_GetNumDomains( self->remotes[fromDim] );
@@ -452,31 +563,29 @@ void IGraph_InvertIncidence( void* _self, int fromDim, int toDim ) {
     // build to counts array first
     nIncEls = AllocArray( int, fromSize );
     memset( nIncEls, 0, fromSize * sizeof(int) );
+    nTotal = 0;
     for( e_i = 0; e_i < toSize; e_i++ ) {
         for( inc_i = 0; inc_i < nInvIncEls[e_i]; inc_i++ )
             nIncEls[invIncEls[e_i][inc_i]]++;
+        nTotal += nInvIncEls[e_i];
     }
 
-    // allocate the memory for storage
-    incEls = AllocArray( int*, fromSize );
+    // reserve each list in order, so the storage is packed as CSR
+    IGraph_FreeIncidence( self, fromDim, toDim );
+    IGraph_AllocIncidence( self, fromDim, toDim, nTotal );
     for( e_i = 0; e_i < fromSize; e_i++ )
-        incEls[e_i] = AllocArray( int, nIncEls[e_i] );
-    memset( nIncEls, 0, fromSize * sizeof(unsigned) ); // re-initialise counts
+        IGraph_ReserveIncidence( self, fromDim, e_i, toDim, nIncEls[e_i] );
+    memset( nIncEls, 0, fromSize * sizeof(int) ); // re-initialise counts
 
     // consturct inverse mapping 
+    incEls = self->incEls[fromDim][toDim];
     for( e_i = 0; e_i < toSize; e_i++ ) {
         for( inc_i = 0; inc_i < nInvIncEls[e_i]; inc_i++ ) {
             elInd = invIncEls[e_i][inc_i];
             incEls[elInd][nIncEls[elInd]++] = e_i;
         }
     }
-
-    for( e_i = 0; e_i < fromSize; e_i++ ) {
-        IGraph_SetIncidence( self, fromDim, e_i, toDim, nIncEls[e_i], incEls[e_i] );
-        FreeArray( incEls[e_i] );
-    }
     FreeArray( nIncEls );
-    FreeArray( incEls );
 }
 
 void IGraph_ExpandIncidence( void* _self, int dim ) {
@@ -491,6 +600,7 @@ void IGraph_ExpandIncidence( void* _self, int dim ) {
     assert( self );
     assert( dim < self->nTDims );
     assert( dim > 0 );
+    IGraph_MaterialiseIncidence( self, dim, 0 );
     assert( self->nIncEls[dim][0] );
 
     nEls = Sync_GetNumDomains( self->remotes[dim] );
@@ -507,14 +617,8 @@ void IGraph_ExpandIncidence( void* _self, int dim ) {
 
     ISet_Init( nbrSet );
     ISet_SetMaxSize( nbrSet, maxNbrs );
-    if( !self->nIncEls[dim][dim] ) {
-        self->nIncEls[dim][dim] = AllocArray( int, nEls );
-        memset( self->nIncEls[dim][dim], 0, nEls * sizeof(int) );
-    }
-    if( !self->incEls[dim][dim] ) {
-        self->incEls[dim][dim] = AllocArray( int*, nEls );
-        memset( self->incEls[dim][dim], 0, nEls * sizeof(int*) );
-    }
+    if( !self->nIncEls[dim][dim] )
+        IGraph_AllocIncidence( self, dim, dim, 0 );
     for( e_i = 0; e_i < nEls; e_i++ ) {
         nIncEls = self->nIncEls[dim][0][e_i];
         incEls = self->incEls[dim][0][e_i];
@@ -527,9 +631,10 @@ void IGraph_ExpandIncidence( void* _self, int dim ) {
                 ISet_TryInsert( nbrSet, upEls[inc_j] );
             }
         }
-        self->nIncEls[dim][dim][e_i] = ISet_GetSize( nbrSet );
-        self->incEls[dim][dim][e_i] = ReallocArray( self->incEls[dim][dim][e_i], int, self->nIncEls[dim][dim][e_i] );
-        ISet_GetArray( nbrSet, self->incEls[dim][dim][e_i] );
+        nCurNbrs = ISet_GetSize( nbrSet );
+        incEls = IGraph_ReserveIncidence( self, dim, e_i, dim, nCurNbrs );
+        if( nCurNbrs )
+            ISet_GetArray( nbrSet, incEls );
         ISet_Clear( nbrSet );
     }
     ISet_Destruct( nbrSet );
@@ -562,6 +667,7 @@ void _IGraph_SetShadowDepth( void* _self, int depth ) {
 
     /* Build ghost set. */
     nDims = self->nDims;
+    IGraph_MaterialiseIncidence( self, nDims, 0 );
     nNbrs = Comm_GetNumNeighbours( self->comm );
     vertSync = self->remotes[0];
     nGhosts = 0;
@@ -667,11 +773,8 @@ void _IGraph_SetShadowDepth( void* _self, int depth ) {
     FreeArray( shdEls[0] );
 
     /* Transfer lower level shadowed elements. */
-    for( n_i = 0; n_i < nNbrs; n_i++ ) {
-        for( e_i = 0; e_i < nNbrGhosts[n_i]; e_i++ ) {
-            nbrGhosts[n_i][e_i] = Decomp_GlobalToLocal( self->locals[nDims], nbrGhosts[n_i][e_i] );
-        }
-    }
+    for( n_i = 0; n_i < nNbrs; n_i++ )
+        Decomp_GlobalsToLocals( self->locals[nDims], nNbrGhosts[n_i], nbrGhosts[n_i] );
     nLowEls = AllocArray( int*, self->nTDims );
     lowEls = AllocArray( int**, self->nTDims );
     for( d_i = nDims - 1; d_i >= 0; d_i-- ) {
@@ -742,11 +845,8 @@ void _IGraph_SetShadowDepth( void* _self, int depth ) {
     for( d_i = 0; d_i < nDims; d_i++ ) {
         if( !nLowEls[d_i] )
             continue;
-        for( n_i = 0; n_i < nNbrs; n_i++ ) {
-            for( e_i = 0; e_i < nLowEls[d_i][n_i]; e_i++ ) {
-                lowEls[d_i][n_i][e_i] = Decomp_GlobalToLocal( self->locals[d_i], lowEls[d_i][n_i][e_i] );
-            }
-        }
+        for( n_i = 0; n_i < nNbrs; n_i++ )
+            Decomp_GlobalsToLocals( self->locals[d_i], nLowEls[d_i][n_i], lowEls[d_i][n_i] );
     }
     for( d_i = nDims; d_i >= 0; d_i-- ) {
         if( !nLowEls[d_i] )
@@ -811,6 +911,7 @@ void IGraph_ClearDims( void* _self ) {
     FreeArray( self->remotes );
     FreeArray( self->nIncEls );
     FreeArray( self->incEls );
+    FreeArray( self->incPacks );
 
     self->nDims = 0;
     self->nTDims = 0;
@@ -819,6 +920,7 @@ void IGraph_ClearDims( void* _self ) {
     self->remotes = NULL;
     self->nIncEls = NULL;
     self->incEls = NULL;
+    self->incPacks = NULL;
 }
 
 void IGraph_ClearElements( void* _self ) {
@@ -842,20 +944,12 @@ void IGraph_ClearElements( void* _self ) {
 
 void IGraph_ClearIncidence( void* _self ) {
     IGraph* self = (IGraph*)_self;
-    int d_i, d_j, e_i;
+    int d_i, d_j;
 
     assert( self );
     for( d_i = 0; d_i < self->nTDims; d_i++ ) {
-        for( d_j = 0; d_j < self->nTDims; d_j++ ) {
-            if( self->nIncEls[d_i][d_j] ) {
-                for( e_i = 0; e_i < Sync_GetNumDomains( self->remotes[d_i] ); e_i++ )
-                    FreeArray( self->incEls[d_i][d_j][e_i] );
-                FreeArray( self->incEls[d_i][d_j] );
-                FreeArray( self->nIncEls[d_i][d_j] );
-                self->nIncEls[d_i][d_j] = NULL;
-                self->incEls[d_i][d_j] = NULL;
-            }
-        }
+        for( d_j = 0; d_j < self->nTDims; d_j++ )
+            IGraph_FreeIncidence( self, d_i, d_j );
     }
 }
 
@@ -893,7 +987,8 @@ Bool IGraph_HasIncidence( const void* self, int fromDim, int toDim ) {
     assert( self );
     assert( fromDim < ((IGraph*)self)->nTDims );
     assert( toDim < ((IGraph*)self)->nTDims );
-    return ((IGraph*)self)->nIncEls[fromDim][toDim] ? True : False;
+    return (((IGraph*)self)->nIncEls[fromDim][toDim] || 
+            IGraph_IsImplicit( (IGraph*)self, fromDim, toDim )) ? True : False;
 }
 
 int IGraph_GetIncidenceSize( const void* self, int fromDim, int fromEl, int toDim ) {
@@ -901,6 +996,8 @@ int IGraph_GetIncidenceSize( const void* self, int fromDim, int fromEl, int toDi
     assert( fromDim < ((IGraph*)self)->nTDims );
     assert( toDim < ((IGraph*)self)->nTDims );
     assert( fromEl < Sync_GetNumDomains( ((IGraph*)self)->remotes[fromDim] ) );
+    if( IGraph_IsImplicit( (IGraph*)self, fromDim, toDim ) )
+        return ((IGraph*)self)->implicitInc->nIncEls;
     return ((IGraph*)self)->nIncEls[fromDim][toDim][fromEl];
 }
 
@@ -911,31 +1008,89 @@ void _IGraph_GetIncidence( void* self, int fromDim, int fromEl, int toDim, IArra
     assert( fromEl < Sync_GetNumDomains( ((IGraph*)self)->remotes[fromDim] ) );
     assert( inc );
 
+    if( IGraph_IsImplicit( (IGraph*)self, fromDim, toDim ) ) {
+        IArray_SoftResize( inc, ((IGraph*)self)->implicitInc->nIncEls );
+        IGraph_ImplicitList( (IGraph*)self, ((IGraph*)self)->implicitInc, fromEl, inc->ptr );
+        return;
+    }
     IArray_SoftResize( inc, ((IGraph*)self)->nIncEls[fromDim][toDim][fromEl] );
     memcpy( inc->ptr, ((IGraph*)self)->incEls[fromDim][toDim][fromEl], IArray_GetSize( inc ) * sizeof(int) );
 }
 
+void IGraph_GetIncidenceArrays( const void* _self, int fromDim, int toDim, 
+                                const int** nIncEls, const int** offs, const int** inds )
+{
+    IGraph* self = (IGraph*)_self;
+
+    assert( self );
+    assert( fromDim < self->nTDims );
+    assert( toDim < self->nTDims );
+    assert( nIncEls && offs && inds );
+
+    IGraph_MaterialiseIncidence( self, fromDim, toDim );
+    *nIncEls = self->nIncEls[fromDim][toDim];
+    *offs = self->incPacks[fromDim][toDim].offs;
+    *inds = self->incPacks[fromDim][toDim].inds;
+}
+
+SizeT IGraph_GetIncidenceMemory( const void* _self, int fromDim, int toDim ) {
+    IGraph* self = (IGraph*)_self;
+    IGraph_Incidence* pack;
+    SizeT mem, boxSize;
+    int d_i;
+
+    assert( self );
+    assert( fromDim < self->nTDims );
+    assert( toDim < self->nTDims );
+
+    mem = 0;
+    if( self->nIncEls[fromDim][toDim] ) {
+        pack = self->incPacks[fromDim] + toDim;
+        mem += pack->nEls * (2 * sizeof(int) + sizeof(int*));
+        mem += pack->maxSize * sizeof(int);
+    }
+    if( IGraph_IsImplicit( self, fromDim, toDim ) ) {
+        mem += sizeof(IGraph_ImplicitIncidence);
+        boxSize = 1;
+        for( d_i = 0; d_i < self->implicitInc->nDims; d_i++ )
+            boxSize *= self->implicitInc->sizes[d_i];
+        mem += (boxSize + self->implicitInc->nIncEls) * sizeof(int);
+    }
+    return mem;
+}
+
 void IGraph_PrintIncidence( const void* _self, int fromDim, int toDim ) {
     IGraph* self = (IGraph*)_self;
     int nEls, global;
     int nIncEls, *incEls;
+    int* implicitEls;
     int e_i, inc_i;
 
     assert( self );
     assert( toDim < self->nTDims );
     assert( fromDim < self->nTDims );
 
+    implicitEls = IGraph_IsImplicit( self, fromDim, toDim ) ? 
+        AllocArray( int, self->implicitInc->nIncEls ) : NULL;
     nEls = Sync_GetNumDomains( self->remotes[fromDim] );
     printf( "Printing incidence for %d elements:\n", nEls );
     for( e_i = 0; e_i < nEls; e_i++ ) {
         global = Sync_DomainToGlobal( self->remotes[fromDim], e_i );
-        nIncEls = self->nIncEls[fromDim][toDim][e_i];
-        incEls = self->incEls[fromDim][toDim][e_i];
+        if( implicitEls ) {
+            nIncEls = self->implicitInc->nIncEls;
+            incEls = implicitEls;
+            IGraph_ImplicitList( self, self->implicitInc, e_i, incEls );
+        }
+        else {
+            nIncEls = self->nIncEls[fromDim][toDim][e_i];
+            incEls = self->incEls[fromDim][toDim][e_i];
+        }
         printf( "   %d, %d incident elements:\n", global, nIncEls );
         for( inc_i = 0; inc_i < nIncEls; inc_i++ ) {
             printf( "      %d\n", incEls[inc_i] );
         }
     }
+    FreeArray( implicitEls );
 }
 
 void IGraph_PickleIncidenceInit( IGraph* self, int dim, int nEls, int* els, int* nBytes ) {
@@ -947,6 +1102,8 @@ void IGraph_PickleIncidenceInit( IGraph* self, int dim, int nEls, int* els, int*
     assert( !nEls || els );
     assert( nBytes );
 
+    if( dim == self->nDims )
+        IGraph_MaterialiseIncidence( self, dim, 0 );
     size = 1;
     for( e_i = 0; e_i < nEls; e_i++ ) {
         size += 1;
@@ -994,7 +1151,7 @@ void IGraph_PickleIncidence( IGraph* self, int dim, int nEls, int* els, stgByte*
 void IGraph_UnpickleIncidence( IGraph* self, int dim, int nBytes, stgByte* bytes ) {
     Sync* sync;
     int nEls, el;
-    int nIncEls, **incEls;
+    int nIncEls, *incEls;
     int curEntry, *entries;
     int inc_i, e_i, d_i;
 
@@ -1002,6 +1159,8 @@ void IGraph_UnpickleIncidence( IGraph* self, int dim, int nBytes, stgByte* bytes
     assert( dim < self->nTDims );
     assert( nBytes && bytes );
 
+    if( dim == self->nDims )
+        IGraph_MaterialiseIncidence( self, dim, 0 );
     sync = self->remotes[dim];
     entries = (int*)bytes;
     nEls = entries[0];
@@ -1013,29 +1172,169 @@ void IGraph_UnpickleIncidence( IGraph* self, int dim, int nBytes, stgByte* bytes
             if( !self->nIncEls[dim][d_i] ) {
                 if( !nIncEls )
                     continue;
-                self->nIncEls[dim][d_i] = AllocArray( int, Sync_GetNumDomains( sync ) );
-                memset( self->nIncEls[dim][d_i], 0, sizeof(int) * Sync_GetNumDomains( sync ) );
+                IGraph_AllocIncidence( self, dim, d_i, 0 );
             }
-            self->nIncEls[dim][d_i][el] = nIncEls;
-            if( !nIncEls ) {
-                if( self->incEls[dim][d_i] )
-                    FreeArray( self->incEls[dim][d_i][el] );
-                continue;
-            }
-            if( !self->incEls[dim][d_i] ) {
-                self->incEls[dim][d_i] = AllocArray( int*, Sync_GetNumDomains( sync ) );
-                memset( self->incEls[dim][d_i], 0, 
-                        Sync_GetNumDomains( sync ) * sizeof(int*) );
-            }
-            incEls = self->incEls[dim][d_i];
-            incEls[el] = ReallocArray( incEls[el], int, nIncEls );
+            incEls = IGraph_ReserveIncidence( self, dim, el, d_i, nIncEls );
             for( inc_i = 0; inc_i < nIncEls; inc_i++ ) {
-                incEls[el][inc_i] = Sync_GlobalToDomain( self->remotes[d_i], entries[curEntry++] );
+                incEls[inc_i] = Sync_GlobalToDomain( self->remotes[d_i], entries[curEntry++] );
             }
         }
     }
 }
 
+void IGraph_AllocIncidence( IGraph* self, int fromDim, int toDim, int maxSize ) {
+    IGraph_Incidence* pack = self->incPacks[fromDim] + toDim;
+    int nEls;
+
+    assert( !self->nIncEls[fromDim][toDim] );
+
+    nEls = Sync_GetNumDomains( self->remotes[fromDim] );
+    self->nIncEls[fromDim][toDim] = AllocArray( int, nEls );
+    self->incEls[fromDim][toDim] = AllocArray( int*, nEls );
+    pack->offs = AllocArray( int, nEls );
+    if( nEls ) {
+        memset( self->nIncEls[fromDim][toDim], 0, nEls * sizeof(int) );
+        memset( self->incEls[fromDim][toDim], 0, nEls * sizeof(int*) );
+        memset( pack->offs, 0, nEls * sizeof(int) );
+    }
+    pack->nEls = nEls;
+    pack->inds = AllocArray( int, maxSize );
+    pack->size = 0;
+    pack->maxSize = maxSize;
+}
+
+void IGraph_ResizeIncidence( IGraph* self, int fromDim, int toDim, int nKeep, int nEls ) {
+    IGraph_Incidence* pack = self->incPacks[fromDim] + toDim;
+    int e_i;
+
+    if( !self->nIncEls[fromDim][toDim] )
+        return;
+    if( !nEls ) {
+        IGraph_FreeIncidence( self, fromDim, toDim );
+        return;
+    }
+
+    /* Lists of dropped elements are left as holes, reclaimed when the storage is repacked. */
+    if( nKeep > pack->nEls )
+        nKeep = pack->nEls;
+    self->nIncEls[fromDim][toDim] = ReallocArray( self->nIncEls[fromDim][toDim], int, nEls );
+    self->incEls[fromDim][toDim] = ReallocArray( self->incEls[fromDim][toDim], int*, nEls );
+    pack->offs = ReallocArray( pack->offs, int, nEls );
+    for( e_i = nKeep; e_i < nEls; e_i++ ) {
+        self->nIncEls[fromDim][toDim][e_i] = 0;
+        self->incEls[fromDim][toDim][e_i] = NULL;
+        pack->offs[e_i] = pack->size;
+    }
+    pack->nEls = nEls;
+}
+
+void IGraph_FreeIncidence( IGraph* self, int fromDim, int toDim ) {
+    IGraph_Incidence* pack = self->incPacks[fromDim] + toDim;
+
+    if( IGraph_IsImplicit( self, fromDim, toDim ) )
+        IGraph_FreeImplicit( self );
+    FreeArray( self->nIncEls[fromDim][toDim] );
+    FreeArray( self->incEls[fromDim][toDim] );
+    FreeArray( pack->offs );
+    FreeArray( pack->inds );
+    self->nIncEls[fromDim][toDim] = NULL;
+    self->incEls[fromDim][toDim] = NULL;
+    memset( pack, 0, sizeof(IGraph_Incidence) );
+}
+
+void IGraph_RepackIncidence( IGraph* self, int fromDim, int toDim, int maxSize ) {
+    IGraph_Incidence* pack = self->incPacks[fromDim] + toDim;
+    int* nIncEls = self->nIncEls[fromDim][toDim];
+    int** incEls = self->incEls[fromDim][toDim];
+    int* inds;
+    int size;
+    int e_i;
+
+    /* Copy the lists in element order, dropping any holes left by replaced lists. */
+    inds = AllocArray( int, maxSize );
+    size = 0;
+    for( e_i = 0; e_i < pack->nEls; e_i++ ) {
+        if( nIncEls[e_i] ) {
+            memcpy( inds + size, pack->inds + pack->offs[e_i], nIncEls[e_i] * sizeof(int) );
+            incEls[e_i] = inds + size;
+        }
+        else
+            incEls[e_i] = NULL;
+        pack->offs[e_i] = size;
+        size += nIncEls[e_i];
+    }
+    FreeArray( pack->inds );
+    pack->inds = inds;
+    pack->size = size;
+    pack->maxSize = maxSize;
+}
+
+int* IGraph_ReserveIncidence( IGraph* self, int fromDim, int fromEl, int toDim, int nIncEls ) {
+    IGraph_Incidence* pack;
+    int* nCurEls;
+    int e_i, nLive;
+
+    /* Guess the storage from this list's size, exact when all lists are the same size. */
+    IGraph_MaterialiseIncidence( self, fromDim, toDim );
+    if( !self->nIncEls[fromDim][toDim] )
+        IGraph_AllocIncidence( self, fromDim, toDim, nIncEls * Sync_GetNumDomains( self->remotes[fromDim] ) );
+    pack = self->incPacks[fromDim] + toDim;
+    nCurEls = self->nIncEls[fromDim][toDim];
+    assert( fromEl < pack->nEls );
+
+    /* Replacement lists no longer than the current one are written in place. */
+    if( nIncEls <= nCurEls[fromEl] ) {
+        nCurEls[fromEl] = nIncEls;
+        if( !nIncEls )
+            self->incEls[fromDim][toDim][fromEl] = NULL;
+        return self->incEls[fromDim][toDim][fromEl];
+    }
+
+    nCurEls[fromEl] = 0;
+    if( pack->size + nIncEls > pack->maxSize ) {
+        nLive = 0;
+        for( e_i = 0; e_i < pack->nEls; e_i++ )
+            nLive += nCurEls[e_i];
+        IGraph_RepackIncidence( self, fromDim, toDim, 2 * (nLive + nIncEls) );
+    }
+
+    nCurEls[fromEl] = nIncEls;
+    pack->offs[fromEl] = pack->size;
+    self->incEls[fromDim][toDim][fromEl] = pack->inds + pack->size;
+    pack->size += nIncEls;
+    return self->incEls[fromDim][toDim][fromEl];
+}
+
+Bool IGraph_IsImplicit( const IGraph* self, int fromDim, int toDim ) {
+    return (self->implicitInc && fromDim == self->implicitInc->nDims && toDim == 0) ? True : False;
+}
+
+void IGraph_ImplicitList( const IGraph* self, const IGraph_ImplicitIncidence* impl, int fromEl, int* list ) {
+    int global, base, stride;
+    int n_i, d_i;
+
+    /* Box index of the element's first vertex, then a fixed offset per vertex. */
+    global = Sync_DomainToGlobal( self->remotes[impl->nDims], fromEl );
+    base = 0;
+    stride = 1;
+    for( d_i = 0; d_i < impl->nDims; d_i++ ) {
+        base += (impl->step * (global % impl->elSizes[d_i]) - impl->lower[d_i]) * stride;
+        global /= impl->elSizes[d_i];
+        stride *= impl->sizes[d_i];
+    }
+    for( n_i = 0; n_i < impl->nIncEls; n_i++ )
+        list[n_i] = impl->vertMap[base + impl->offs[n_i]];
+}
+
+void IGraph_FreeImplicit( IGraph* self ) {
+    if( !self->implicitInc )
+        return;
+    FreeArray( self->implicitInc->vertMap );
+    FreeArray( self->implicitInc->offs );
+    FreeArray( self->implicitInc );
+    self->implicitInc = NULL;
+}
+
 int IGraph_Cmp( const void* l, const void* r ) {
     assert( *(int*)l != *(int*)r );
     return (*(int*)l < *(int*)r) ? -1 : 1;
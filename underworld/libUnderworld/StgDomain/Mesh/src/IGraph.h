@@ -12,6 +12,36 @@
 #define __StgDomain_Mesh_IGraph_h__
 
 extern const Type IGraph_Type;
+
+/* Packed storage for the incidence between one pair of dimensions: each element's list
+   starts at offs[el] in the single inds array. nIncEls and incEls index into this storage,
+   so there is no allocation per element. Lists are appended in the order they are set, so
+   a topology built element by element is stored as CSR. */
+typedef struct {
+    int nEls;
+    int* offs;
+    int* inds;
+    int size;
+    int maxSize;
+} IGraph_Incidence;
+
+/* Implicit incidence from the elements of a structured mesh to its vertices. The element at
+   position (i,j,k) of the global element grid, x fastest, is incident on the (step+1)^nDims
+   vertices starting at step*(i,j,k) in the global vertex grid, also x fastest. Only the
+   domain vertices of the box spanned by the domain elements are stored, in vertMap, and an
+   element's list is its first vertex's box index plus offs, so the storage is about one int
+   per domain vertex rather than nIncEls per domain element. */
+typedef struct {
+    int nDims;
+    int elSizes[3];
+    int vertSizes[3];
+    int step;
+    int lower[3];
+    int sizes[3];
+    int* vertMap;
+    int nIncEls;
+    int* offs;
+} IGraph_ImplicitIncidence;
         
 #define __IGraph                                \
     __MeshTopology                              \
@@ -20,7 +50,9 @@ extern const Type IGraph_Type;
     int* nBndEls;                               \
     int** bndEls;                               \
     int*** nIncEls;                             \
-    int**** incEls;
+    int**** incEls;                             \
+    IGraph_Incidence** incPacks;                \
+    IGraph_ImplicitIncidence* implicitInc;
 
 struct IGraph { __IGraph };
 
@@ -72,6 +104,16 @@ void IGraph_SetIncidence( void* _self, int fromDim, int fromEl, int toDim, int n
 
 void IGraph_RemoveIncidence( void* _self, int fromDim, int toDim );
 
+/* Replaces the explicit element to vertex incidence by the implicit form for an element grid
+   of sizes elSizes whose vertex grid has step vertices per element along each axis, eg. 1
+   for linear and 2 for quadratic elements. The explicit incidence must already be set; it is
+   only replaced when every domain element's list matches and the implicit form is smaller,
+   and True is returned if so. Explicit lists are rebuilt on demand, by
+   IGraph_MaterialiseIncidence, when something needs the raw arrays or changes the graph. */
+Bool IGraph_SetImplicitIncidence( void* _self, const int* elSizes, int step );
+
+void IGraph_MaterialiseIncidence( void* _self, int fromDim, int toDim );
+
 void IGraph_InvertIncidence( void* _self, int fromDim, int toDim );
 
 void IGraph_ExpandIncidence( void* _self, int dim );
@@ -102,6 +144,14 @@ int IGraph_GetIncidenceSize( const void* self, int fromDim, int fromEl, int toDi
 
 void _IGraph_GetIncidence( void* self, int fromDim, int fromEl, int toDim, IArray* inc );
 
+/* Direct access to the packed incidence; the list of element el is the nIncEls[el] entries
+   starting at inds[offs[el]]. The arrays are owned by the graph. */
+void IGraph_GetIncidenceArrays( const void* self, int fromDim, int toDim, 
+                                const int** nIncEls, const int** offs, const int** inds );
+
+/* Bytes held by the incidence from fromDim to toDim, explicit or implicit. */
+SizeT IGraph_GetIncidenceMemory( const void* _self, int fromDim, int toDim );
+
 void IGraph_PrintIncidence( const void* _self, int fromDim, int toDim );
 
 #endif /* __StgDomain_Mesh_IGraph_h__ */
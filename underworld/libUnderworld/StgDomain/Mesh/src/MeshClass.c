@@ -67,6 +67,7 @@ Mesh* _Mesh_New(  MESH_DEFARGS  ) {
 
 
 	self->minSep = 0.0;
+	self->minSepValid = True;
 	self->minAxialSep = NULL;
 	self->minLocalCrd = NULL;
 	self->maxLocalCrd = NULL;
@@ -95,6 +96,15 @@ Mesh* _Mesh_New(  MESH_DEFARGS  ) {
 	self->emReg = NULL;
 
 	self->isDeforming     = False;
+	self->geometryVersion = 0;
+	self->updateVerts = NULL;
+	self->elSep = NULL;
+	self->elAxialSep = NULL;
+	self->staleSeps = NULL;
+	self->movedEls = NULL;
+	self->localRangeVerts = NULL;
+	self->movedElsBase = 0;
+	self->parentMeshVersion = 0;
 
 	self->isRegular = False;
     self->parentMesh = NULL;
@@ -454,6 +464,24 @@ void Mesh_GetIncidence( void* mesh, MeshTopology_Dim fromDim, unsigned fromInd,
 	MeshTopology_GetIncidence( self->topo, fromDim, fromInd, toDim, inc );
 }
 
+SizeT Mesh_GetIncidenceMemory( void* mesh, MeshTopology_Dim fromDim, MeshTopology_Dim toDim ) {
+	Mesh*	self = (Mesh*)mesh;
+
+	assert( self );
+	assert( self->topo );
+
+	return IGraph_GetIncidenceMemory( self->topo, fromDim, toDim );
+}
+
+void Mesh_MaterialiseIncidence( void* mesh, MeshTopology_Dim fromDim, MeshTopology_Dim toDim ) {
+	Mesh*	self = (Mesh*)mesh;
+
+	assert( self );
+	assert( self->topo );
+
+	IGraph_MaterialiseIncidence( self->topo, fromDim, toDim );
+}
+
 unsigned Mesh_NearestVertex( void* mesh, double* point ) {
 	Mesh*	self = (Mesh*)mesh;
 
@@ -561,17 +589,6 @@ void* Mesh_GetTopologyData( void* mesh, MeshTopology_Dim topodim ) {
 	return self->topoDatas[topodim];
 }
 
-void Mesh_GetMinimumSeparation( void* mesh, double* minSep, double* axial ) {
-	Mesh*	self = (Mesh*)mesh;
-
-	assert( self );
-	assert( minSep );
-
-	*minSep = self->minSep;
-	if( axial )
-		memcpy( axial, self->minAxialSep, Mesh_GetDimSize( self ) * sizeof(double) );
-}
-
 void Mesh_GetLocalCoordRange( void* mesh, double* min, double* max ) {
 	Mesh*	self = (Mesh*)mesh;
 
@@ -603,20 +620,304 @@ void Mesh_GetGlobalCoordRange( void* mesh, double* min, double* max ) {
 	memcpy( max, self->maxGlobalCrd, Mesh_GetDimSize( self ) * sizeof(double) );
 }
 
-void Mesh_DeformationUpdate( void* mesh ) {
-	Mesh*	self = (Mesh*)mesh;
+/* The fused coordinate range updates below replace the generic (vertex based) range algorithms only. */
+static Bool _Mesh_HasGenericCoordRanges( Mesh* self ) {
+	Mesh_Algorithms* algorithms = self->algorithms;
+
+	return ( algorithms->getLocalCoordRangeFunc == _Mesh_Algorithms_GetLocalCoordRange &&
+		 algorithms->getDomainCoordRangeFunc == _Mesh_Algorithms_GetDomainCoordRange &&
+		 algorithms->getGlobalCoordRangeFunc == _Mesh_Algorithms_GetGlobalCoordRange ) ? True : False;
+}
+
+/*
+ * Incremental updates need the generic (element based) separation and coordinate range
+ * algorithms, so their results may be maintained element by element, and the elements
+ * incident on each vertex.
+ */
+static Bool _Mesh_CanUpdateIncrementally( Mesh* self ) {
+	return ( self->algorithms->getMinimumSeparationFunc == _Mesh_Algorithms_GetMinimumSeparation &&
+		 _Mesh_HasGenericCoordRanges( self ) &&
+		 Mesh_HasIncidence( self, MT_VERTEX, Mesh_GetDimSize( self ) ) ) ? True : False;
+}
+
+/* Recomputes the cached separation of the flagged (or all, if NULL) elements, and the mesh minimum. */
+static void _Mesh_UpdateElementSeparations( Mesh* self, const Bool* elements ) {
+	unsigned	nDims = Mesh_GetDimSize( self );
+	unsigned	nEls = Mesh_GetDomainSize( self, nDims );
+	unsigned	e_i;
+
+	for( e_i = 0; e_i < nEls; e_i++ ) {
+		if( elements && !elements[e_i] )
+			continue;
+		self->elSep[e_i] = Mesh_ElementType_GetMinimumSeparation( Mesh_GetElementType( self, e_i ), e_i,
+									  self->elAxialSep + e_i * nDims );
+	}
+
+	self->minSep = HUGE_VAL;
+	for( e_i = 0; e_i < nEls; e_i++ ) {
+		if( self->elSep[e_i] < self->minSep ) {
+			self->minSep = self->elSep[e_i];
+			memcpy( self->minAxialSep, self->elAxialSep + e_i * nDims, nDims * sizeof(double) );
+		}
+	}
+}
+
+/*
+ * The minimum separation is only computed when asked for, as few deformation updates are followed
+ * by a query (ie. a timestep calculation). Only the elements moved since it was last computed are
+ * visited when the element separations are cached.
+ */
+void Mesh_GetMinimumSeparation( void* mesh, double* minSep, double* axial ) {
+	Mesh*		self = (Mesh*)mesh;
+	unsigned	nEls, e_i;
 
 	assert( self );
+	assert( minSep );
 
-	if( Mesh_GetDomainSize( self, 0 ) ) {
-		self->minSep = Mesh_Algorithms_GetMinimumSeparation( self->algorithms, self->minAxialSep );
+	if( !self->minSepValid ) {
+		if( self->elSep ) {
+			_Mesh_UpdateElementSeparations( self, self->staleSeps );
+			nEls = Mesh_GetDomainSize( self, Mesh_GetDimSize( self ) );
+			for( e_i = 0; e_i < nEls; e_i++ )
+				self->staleSeps[e_i] = False;
+		}
+		else
+			self->minSep = Mesh_Algorithms_GetMinimumSeparation( self->algorithms, self->minAxialSep );
+		self->minSepValid = True;
+	}
+
+	*minSep = self->minSep;
+	if( axial )
+		memcpy( axial, self->minAxialSep, Mesh_GetDimSize( self ) * sizeof(double) );
+}
+
+/* Flags the domain vertices of the local elements, which bound the local coordinate range. */
+static void _Mesh_BuildLocalRangeVertices( Mesh* self ) {
+	unsigned	nDims = Mesh_GetDimSize( self );
+	unsigned	nVerts = Mesh_GetDomainSize( self, MT_VERTEX );
+	unsigned	nLocalEls = Mesh_GetLocalSize( self, nDims );
+	IArray*		inc = IArray_New();
+	unsigned	nIncVerts, *incVerts;
+	unsigned	v_i, e_i;
+
+	self->localRangeVerts = Memory_Alloc_Array( Bool, nVerts, "Mesh::localRangeVerts" );
+	for( v_i = 0; v_i < nVerts; v_i++ )
+		self->localRangeVerts[v_i] = False;
+	/* the local range also always includes the first vertex */
+	self->localRangeVerts[0] = True;
+	for( e_i = 0; e_i < nLocalEls; e_i++ ) {
+		Mesh_GetIncidence( self, nDims, e_i, MT_VERTEX, inc );
+		nIncVerts = IArray_GetSize( inc );
+		incVerts = (unsigned*)IArray_GetPtr( inc );
+		for( v_i = 0; v_i < nIncVerts; v_i++ )
+			self->localRangeVerts[incVerts[v_i]] = True;
+	}
+	Stg_Class_Delete( inc );
+}
+
+/*
+ * Recomputes the local and domain coordinate ranges together in a single pass over the domain
+ * vertices, rather than walking the local elements and then the domain vertices.
+ */
+static void _Mesh_UpdateCoordRanges( Mesh* self ) {
+	unsigned	nDims = Mesh_GetDimSize( self );
+	unsigned	nVerts = Mesh_GetDomainSize( self, MT_VERTEX );
+	double*		vert;
+	unsigned	v_i, d_i;
+
+	if( !self->localRangeVerts )
+		_Mesh_BuildLocalRangeVertices( self );
+
+	vert = Mesh_GetVertex( self, 0 );
+	memcpy( self->minLocalCrd, vert, nDims * sizeof(double) );
+	memcpy( self->maxLocalCrd, vert, nDims * sizeof(double) );
+	memcpy( self->minDomainCrd, vert, nDims * sizeof(double) );
+	memcpy( self->maxDomainCrd, vert, nDims * sizeof(double) );
+	for( v_i = 1; v_i < nVerts; v_i++ ) {
+		vert = Mesh_GetVertex( self, v_i );
+		for( d_i = 0; d_i < nDims; d_i++ ) {
+			if( vert[d_i] < self->minDomainCrd[d_i] )
+				self->minDomainCrd[d_i] = vert[d_i];
+			if( vert[d_i] > self->maxDomainCrd[d_i] )
+				self->maxDomainCrd[d_i] = vert[d_i];
+		}
+		if( !self->localRangeVerts[v_i] )
+			continue;
+		for( d_i = 0; d_i < nDims; d_i++ ) {
+			if( vert[d_i] < self->minLocalCrd[d_i] )
+				self->minLocalCrd[d_i] = vert[d_i];
+			if( vert[d_i] > self->maxLocalCrd[d_i] )
+				self->maxLocalCrd[d_i] = vert[d_i];
+		}
+	}
+}
+
+/* The global range is reduced from the local ranges in a single collective. */
+static void _Mesh_UpdateGlobalCoordRange( Mesh* self ) {
+	unsigned	nDims = Mesh_GetDimSize( self );
+	MPI_Comm	comm = Comm_GetMPIComm( Mesh_GetCommTopology( self, MT_VERTEX ) );
+	double		range[6];
+	unsigned	d_i;
+
+	for( d_i = 0; d_i < nDims; d_i++ ) {
+		range[d_i] = self->minLocalCrd[d_i];
+		range[nDims + d_i] = -self->maxLocalCrd[d_i];
+	}
+	MPI_Allreduce( MPI_IN_PLACE, range, 2 * nDims, MPI_DOUBLE, MPI_MIN, comm );
+	for( d_i = 0; d_i < nDims; d_i++ ) {
+		self->minGlobalCrd[d_i] = range[d_i];
+		self->maxGlobalCrd[d_i] = -range[nDims + d_i];
+	}
+}
+
+static void _Mesh_FullDeformationUpdate( Mesh* self, Bool incremental ) {
+	unsigned	nDims = Mesh_GetDimSize( self );
+	unsigned	nVerts = Mesh_GetDomainSize( self, MT_VERTEX );
+	unsigned	nEls = Mesh_GetDomainSize( self, nDims );
+	unsigned	e_i;
+
+	self->geometryVersion++;
+	self->minSepValid = False;
+
+	if( incremental ) {
+		if( !self->updateVerts ) {
+			self->updateVerts = Memory_Alloc_Array( double, nVerts * nDims, "Mesh::updateVerts" );
+			self->elSep = Memory_Alloc_Array( double, nEls, "Mesh::elSep" );
+			self->elAxialSep = Memory_Alloc_Array( double, nEls * nDims, "Mesh::elAxialSep" );
+			self->staleSeps = Memory_Alloc_Array( Bool, nEls, "Mesh::staleSeps" );
+			self->movedEls = Memory_Alloc_Array( Bool, nEls, "Mesh::movedEls" );
+		}
+		for( e_i = 0; e_i < nEls; e_i++ ) {
+			self->staleSeps[e_i] = True;
+			self->movedEls[e_i] = True;
+		}
+		self->movedElsBase = self->geometryVersion - 1;
+	}
+	else {
+		KillArray( self->updateVerts );
+		KillArray( self->elSep );
+		KillArray( self->elAxialSep );
+		KillArray( self->staleSeps );
+		KillArray( self->movedEls );
+	}
+
+	if( _Mesh_HasGenericCoordRanges( self ) ) {
+		_Mesh_UpdateCoordRanges( self );
+		_Mesh_UpdateGlobalCoordRange( self );
+	}
+	else {
 		Mesh_Algorithms_GetLocalCoordRange( self->algorithms, self->minLocalCrd, self->maxLocalCrd );
 		Mesh_Algorithms_GetDomainCoordRange( self->algorithms, self->minDomainCrd, self->maxDomainCrd );
 		Mesh_Algorithms_GetGlobalCoordRange( self->algorithms, self->minGlobalCrd, self->maxGlobalCrd );
+	}
+}
+
+/*
+ * Compares the vertices against those of the last update, flagging the elements incident on moved
+ * vertices so only their separations are refreshed (when next asked for). The coordinate ranges are
+ * extended to include the moved vertices, and are only recomputed where a vertex on their boundary
+ * has moved (the only way they may shrink).
+ */
+static void _Mesh_IncrementalDeformationUpdate( Mesh* self ) {
+	unsigned	nDims = Mesh_GetDimSize( self );
+	unsigned	nVerts = Mesh_GetDomainSize( self, MT_VERTEX );
+	unsigned	nEls = Mesh_GetDomainSize( self, nDims );
+	unsigned	nLocalEls = Mesh_GetLocalSize( self, nDims );
+	IArray*		inc = IArray_New();
+	Bool		rebuild = False, inLocal;
+	unsigned	nMoved = 0, nIncEls, *incEls;
+	double		*prev, *vert;
+	unsigned	v_i, e_i, d_i;
+
+	for( e_i = 0; e_i < nEls; e_i++ )
+		self->movedEls[e_i] = False;
+
+	for( v_i = 0; v_i < nVerts; v_i++ ) {
+		prev = self->updateVerts + v_i * nDims;
+		vert = Mesh_GetVertex( self, v_i );
+		if( !memcmp( prev, vert, nDims * sizeof(double) ) )
+			continue;
+		nMoved++;
+
+		Mesh_GetIncidence( self, MT_VERTEX, v_i, nDims, inc );
+		nIncEls = IArray_GetSize( inc );
+		incEls = (unsigned*)IArray_GetPtr( inc );
+		/* the local range also always includes the first vertex */
+		inLocal = ( v_i == 0 ) ? True : False;
+		for( e_i = 0; e_i < nIncEls; e_i++ ) {
+			self->movedEls[incEls[e_i]] = True;
+			self->staleSeps[incEls[e_i]] = True;
+			if( incEls[e_i] < nLocalEls )
+				inLocal = True;
+		}
+
+		for( d_i = 0; d_i < nDims; d_i++ ) {
+			if( prev[d_i] == self->minDomainCrd[d_i] || prev[d_i] == self->maxDomainCrd[d_i] )
+				rebuild = True;
+			if( vert[d_i] < self->minDomainCrd[d_i] )
+				self->minDomainCrd[d_i] = vert[d_i];
+			if( vert[d_i] > self->maxDomainCrd[d_i] )
+				self->maxDomainCrd[d_i] = vert[d_i];
+			if( !inLocal )
+				continue;
+			if( prev[d_i] == self->minLocalCrd[d_i] || prev[d_i] == self->maxLocalCrd[d_i] )
+				rebuild = True;
+			if( vert[d_i] < self->minLocalCrd[d_i] )
+				self->minLocalCrd[d_i] = vert[d_i];
+			if( vert[d_i] > self->maxLocalCrd[d_i] )
+				self->maxLocalCrd[d_i] = vert[d_i];
+		}
+	}
+	Stg_Class_Delete( inc );
+
+	self->movedElsBase = self->geometryVersion;
+	if( nMoved ) {
+		self->geometryVersion++;
+		self->minSepValid = False;
+		if( rebuild )
+			_Mesh_UpdateCoordRanges( self );
+	}
+
+	_Mesh_UpdateGlobalCoordRange( self );
+}
+
+void Mesh_DeformationUpdate( void* mesh ) {
+	Mesh*	self = (Mesh*)mesh;
+	Bool	incremental;
+
+	assert( self );
+
+	if( Mesh_GetDomainSize( self, 0 ) ) {
+		incremental = _Mesh_CanUpdateIncrementally( self );
+		if( incremental && self->updateVerts )
+			_Mesh_IncrementalDeformationUpdate( self );
+		else
+			_Mesh_FullDeformationUpdate( self, incremental );
+		if( incremental ) {
+			memcpy( self->updateVerts, self->vertices,
+				Mesh_GetDomainSize( self, MT_VERTEX ) * Mesh_GetDimSize( self ) * sizeof(double) );
+		}
 
 		Mesh_Algorithms_Update( self->algorithms );
         Mesh_ElementType_Update( self->elTypes[0] );
 	}
+	else
+		self->geometryVersion++;
+}
+
+/*
+ * Returns the flags of the domain elements moved by the last deformation update, if that update
+ * was made from the geometry at 'version'. Otherwise (or where moved elements are not tracked)
+ * returns NULL, and any element may have moved since 'version'.
+ */
+const Bool* Mesh_GetMovedElements( void* mesh, unsigned version ) {
+	Mesh*	self = (Mesh*)mesh;
+
+	assert( self );
+
+	if( !self->movedEls || version != self->movedElsBase )
+		return NULL;
+	return self->movedEls;
 }
 
 StgVariable* Mesh_GenerateNodeGlobalIdVar( void* mesh ) {
@@ -808,6 +1109,12 @@ void Mesh_Destruct( Mesh* self ) {
 	self->nElTypes = 0;
 
 	KillArray( self->vertices );
+	KillArray( self->updateVerts );
+	KillArray( self->elSep );
+	KillArray( self->elAxialSep );
+	KillArray( self->staleSeps );
+	KillArray( self->movedEls );
+	KillArray( self->localRangeVerts );
     Stg_Component_Destroy(self->verticesVariable, NULL, False);
     self->verticesVariable = NULL;
     KillArray( self->verticesgid );
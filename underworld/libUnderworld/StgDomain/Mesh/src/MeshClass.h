@@ -41,6 +41,7 @@
         unsigned            localtotalNodes; \
 								\
 		double				minSep;		\
+		Bool				minSepValid;	/* is minSep up to date with the vertices */ \
 		double*				minAxialSep;	\
 		double*				minLocalCrd;	\
 		double*				maxLocalCrd;	\
@@ -68,6 +69,20 @@
 		MeshGenerator*			generator;	\
 		/* determines if mesh requires storing (it may already have been stored) */ \
 		Bool                            isDeforming;        \
+		/* incremented by each Mesh_DeformationUpdate which moves vertices, so cached geometry can be checked for staleness */ \
+		unsigned                        geometryVersion;    \
+		/* incremental deformation update state: the domain vertices at the last update, the cached \
+		   separation of each domain element, the elements whose cached separation is out of date, and \
+		   the elements moved by the last update */ \
+		double*                         updateVerts;        \
+		double*                         elSep;              \
+		double*                         elAxialSep;         \
+		Bool*                           staleSeps;          \
+		Bool*                           movedEls;           \
+		unsigned                        movedElsBase;       /* geometryVersion prior to the last update */ \
+		Bool*                           localRangeVerts;    /* domain vertices bounding the local coordinate range */ \
+		/* geometryVersion of the parent mesh when this mesh's geometry was last generated from it */ \
+		unsigned                        parentMeshVersion;  \
 		ExtensionManager_Register*	emReg;                  \
         Mesh*             parentMesh;  /* If this mesh is generated based on a 'parent' mesh, record here. */
                                        /* Else record self */
@@ -141,6 +156,10 @@
 					MeshTopology_Dim toDim );
 	void Mesh_GetIncidence( void* mesh, MeshTopology_Dim fromDim, unsigned fromInd, MeshTopology_Dim toDim, 
 				IArray* inc );
+	/* Bytes held by the incidence from fromDim to toDim, and storing it as explicit lists when
+	   it is answered implicitly, eg. to compare the two. */
+	SizeT Mesh_GetIncidenceMemory( void* mesh, MeshTopology_Dim fromDim, MeshTopology_Dim toDim );
+	void Mesh_MaterialiseIncidence( void* mesh, MeshTopology_Dim fromDim, MeshTopology_Dim toDim );
 
 	unsigned Mesh_NearestVertex( void* mesh, double* point );
 	Bool Mesh_Search( void* mesh, double* point, 
@@ -175,6 +194,7 @@
 	void Mesh_GetGlobalCoordRange( void* mesh, double* min, double* max );
 
 	void Mesh_DeformationUpdate( void* mesh );
+	const Bool* Mesh_GetMovedElements( void* mesh, unsigned version );
 	void Mesh_Sync( void* mesh );
 
     void Mesh_GenerateVertices( void* mesh, unsigned nVerts, unsigned nDims );
@@ -136,7 +136,8 @@ void _Mesh_Algorithms_Execute( void* algorithms, void* data ) {
 void _Mesh_Algorithms_Destroy( void* algorithms, void* data ) {
 	Mesh_Algorithms*	self = (Mesh_Algorithms*)algorithms;
 	Stg_Class_Delete( self->incArray );
-    if(self->tree) Stg_Component_Destroy( self->tree, data, False );
+    if(self->tree) Stg_Class_Delete( self->tree );
+    self->tree = NULL;
 }
 
 void _Mesh_Algorithms_SetMesh( void* algorithms, void* mesh ) {
@@ -154,19 +155,11 @@ void _Mesh_Algorithms_Update( void* algorithms ) {
 
 	assert( self );
 
-#if 0
-	if( !self->mesh ) {
-	   if( self->tree )
-	      SpatialTree_Clear( self->tree );
-	   return;
-	}
-
+	/* The tree is only (re)built when first searched after the geometry changes. */
 	if( !self->tree )
 	   self->tree = SpatialTree_New();
-	SpatialTree_SetMesh( self->tree, self->mesh );
-	SpatialTree_Rebuild( self->tree );
-	self->search = Mesh_Algorithms_SearchWithTree;
-#endif
+	if( self->tree->mesh != self->mesh )
+	   SpatialTree_SetMesh( self->tree, self->mesh );
 
 	if( Mesh_HasIncidence( self->mesh, MT_VERTEX, MT_VERTEX ) )
 	{
@@ -184,10 +177,8 @@ void _Mesh_Algorithms_Update( void* algorithms ) {
 	}
 	if( d_i == nDims )
 		self->search = Mesh_Algorithms_SearchWithFullIncidence;
-	else if( Mesh_HasIncidence( self->mesh, MT_VERTEX, Mesh_GetDimSize( self->mesh ) ) )
-		self->search = Mesh_Algorithms_SearchWithMinIncidence;
 	else
-		self->search = Mesh_Algorithms_SearchGeneral;
+		self->search = Mesh_Algorithms_SearchWithTree;
 }
 
 unsigned _Mesh_Algorithms_NearestVertex( void* algorithms, double* point ) {
@@ -700,39 +691,47 @@ Bool Mesh_Algorithms_SearchGeneral( void* algorithms, double* point,
 	return False;
 }
 
-Bool Mesh_Algorithms_SearchWithTree( void* _self, double* pnt, unsigned* dim, unsigned* el ) {
-   Mesh_Algorithms* self = (Mesh_Algorithms*)_self;
-   int nEls, *els;
-   unsigned curDim, curEl;
-	int curRank;
-   int nLocals, owner;
-   int ii;
-
-   *dim = Mesh_GetDimSize( self->mesh );
-   MPI_Comm_size( MPI_COMM_WORLD, &curRank );
-   nLocals = Mesh_GetLocalSize( self->mesh, *dim );
-   if( !SpatialTree_Search( self->tree, pnt, &nEls, &els ) )
-      return False;
-
-   *el = nLocals;
-   for( ii = 0; ii < nEls; ii++ ) {
-      if( Mesh_ElementHasPoint( self->mesh, els[ii], pnt, &curDim, &curEl ) ) {
-	 if( curEl >= nLocals ) {
-	    owner = Mesh_GetOwner( self->mesh, curDim, curEl - nLocals );
-	    owner = Comm_RankLocalToGlobal( self->mesh->topo->comm, owner );
-	    if( owner <= curRank ) {
-	       curRank = owner;
-	       *el = curEl;
-	    }
-	 }
-	 else if( self->rank <= curRank && curEl < *el ) {
-	    curRank = self->rank;
-	    *el = curEl;
-	 }
-      }
-   }
+Bool Mesh_Algorithms_SearchWithTree( void* algorithms, double* point, 
+				     MeshTopology_Dim* dim, unsigned* ind )
+{
+	Mesh_Algorithms*	self = (Mesh_Algorithms*)algorithms;
+	Mesh*			mesh;
+	unsigned		lowest, global;
+	unsigned		nDims;
+	MeshTopology_Dim	curDim;
+	unsigned		curInd;
+	int			nEls, *els;
+	int			e_i;
+
+	assert( self );
+	assert( self->mesh );
+	assert( self->tree );
+	assert( dim );
+	assert( ind );
+
+	mesh = self->mesh;
+	nDims = Mesh_GetDimSize( mesh );
+
+	/* Outside the domain range, immediately return false. */
+	if( !SpatialTree_Search( self->tree, point, &nEls, &els ) )
+		return False;
+
+	/* The candidates include every element whose bounding box holds the point, so
+	   return the element with lowest global index, as a brute force search would. */
+	lowest = (unsigned)-1;
+	for( e_i = 0; e_i < nEls; e_i++ ) {
+		if( Mesh_ElementHasPoint( mesh, els[e_i], point, &curDim, &curInd ) ) {
+			global = Mesh_DomainToGlobal( mesh, nDims, els[e_i] );
+			if( global < lowest )
+				lowest = global;
+		}
+	}
+	if( lowest == (unsigned)-1 )
+		return False;
 
-   return True;
+	insist( Mesh_GlobalToDomain( mesh, nDims, lowest, ind ), == True );
+	*dim = nDims;
+	return True;
 }
 /*----------------------------------------------------------------------------------------------------------------------------------
 ** Private Functions
@@ -162,6 +162,8 @@
 						     MeshTopology_Dim* dim, unsigned* ind );
 	Bool Mesh_Algorithms_SearchGeneral( void* algorithms, double* point, 
 					    MeshTopology_Dim* dim, unsigned* ind );
+	Bool Mesh_Algorithms_SearchWithTree( void* algorithms, double* point, 
+					     MeshTopology_Dim* dim, unsigned* ind );
 
 	/*--------------------------------------------------------------------------------------------------------------------------
 	** Private Member functions
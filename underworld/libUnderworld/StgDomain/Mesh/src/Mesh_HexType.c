@@ -449,11 +449,11 @@ Bool Mesh_HexType_ElementHasPoint3DWithIncidence( Mesh_HexType* self, unsigned e
 			if( bc[1] == 0.0 || bc[1] == -0.0 ) {
 				if( bc[2] == 0.0 || bc[2] == -0.0 ) {
 					*dim = MT_VERTEX;
-					*ind = topo->incEls[MT_VOLUME][MT_VERTEX][elInd][inds[3]];
+					*ind = inc[inds[3]];
 				}
 				else if( bc[3] == 0.0 || bc[3] == -0.0 ) {
 					*dim = MT_VERTEX;
-					*ind = topo->incEls[MT_VOLUME][MT_VERTEX][elInd][inds[2]];
+					*ind = inc[inds[2]];
 				}
 				else {
 					if( inside == 0 ) {
@@ -501,7 +501,7 @@ Bool Mesh_HexType_ElementHasPoint3DWithIncidence( Mesh_HexType* self, unsigned e
 			else if( bc[2] == 0.0 || bc[2] == -0.0 ) {
 				if( bc[3] == 0.0 || bc[3] == -0.0 ) {
 					*dim = MT_VERTEX;
-					*ind = topo->incEls[MT_VOLUME][MT_VERTEX][elInd][inds[1]];
+					*ind = inc[inds[1]];
 				}
 				else {
 					if( inside == 0 ) {
@@ -635,7 +635,7 @@ Bool Mesh_HexType_ElementHasPoint3DWithIncidence( Mesh_HexType* self, unsigned e
 			if( bc[2] == 0.0 || bc[2] == -0.0 ) {
 				if( bc[3] == 0.0 || bc[3] == -0.0 ) {
 					*dim = MT_VERTEX;
-					*ind = topo->incEls[MT_VOLUME][MT_VERTEX][elInd][inds[0]];
+					*ind = inc[inds[0]];
 				}
 				else {
 					if( inside == 0 ) {
@@ -992,11 +992,11 @@ Bool Mesh_HexType_ElementHasPoint2DWithIncidence( Mesh_HexType* self, unsigned e
 		if( bc[0] == 0.0 || bc[0] == -0.0 ) {
 			if( bc[1] == 0.0 || bc[1] == -0.0 ) {
 				*dim = MT_VERTEX;
-				*ind = topo->incEls[MT_FACE][MT_VERTEX][elInd][inds[2]];
+				*ind = inc[inds[2]];
 			}
 			else if( bc[2] == 0.0 || bc[2] == -0.0 ) {
 				*dim = MT_VERTEX;
-				*ind = topo->incEls[MT_FACE][MT_VERTEX][elInd][inds[1]];
+				*ind = inc[inds[1]];
 			}
 			else {
 				if( inside == 0 ) {
@@ -1012,7 +1012,7 @@ Bool Mesh_HexType_ElementHasPoint2DWithIncidence( Mesh_HexType* self, unsigned e
 		else if( bc[1] == 0.0 || bc[1] == -0.0 ) {
 			if( bc[2] == 0.0 || bc[2] == -0.0 ) {
 				*dim = MT_VERTEX;
-				*ind = topo->incEls[MT_FACE][MT_VERTEX][elInd][inds[0]];
+				*ind = inc[inds[0]];
 			}
 			else {
 				if( inside == 0 ) {
@@ -42,8 +42,8 @@ Mesh_RegularAlgorithms* Mesh_RegularAlgorithms_New( Name name, AbstractContext*
 	AllocationType                                   nameAllocationType = NON_GLOBAL;
 	Mesh_Algorithms_SetMeshFunc*                            setMeshFunc = Mesh_RegularAlgorithms_SetMesh;
 	Mesh_Algorithms_UpdateFunc*                              updateFunc = Mesh_RegularAlgorithms_Update;
-	Mesh_Algorithms_NearestVertexFunc*                nearestVertexFunc = _Mesh_Algorithms_NearestVertex;
-	Mesh_Algorithms_SearchFunc*                              searchFunc = _Mesh_Algorithms_Search;
+	Mesh_Algorithms_NearestVertexFunc*                nearestVertexFunc = Mesh_RegularAlgorithms_NearestVertex;
+	Mesh_Algorithms_SearchFunc*                              searchFunc = Mesh_RegularAlgorithms_Search;
 	Mesh_Algorithms_SearchElementsFunc*              searchElementsFunc = Mesh_RegularAlgorithms_SearchElements;
 	Mesh_Algorithms_GetMinimumSeparationFunc*  getMinimumSeparationFunc = _Mesh_Algorithms_GetMinimumSeparation;
 	Mesh_Algorithms_GetLocalCoordRangeFunc*      getLocalCoordRangeFunc = _Mesh_Algorithms_GetLocalCoordRange;
@@ -74,7 +74,12 @@ void _Mesh_RegularAlgorithms_Init( void* algorithms ) {
 
 	assert( self && Stg_CheckType( self, Mesh_RegularAlgorithms ) );
 
+	self->elGrid = NULL;
+	self->vertGrid = NULL;
 	self->sep = NULL;
+	self->vertSep = NULL;
+	self->minCrd = NULL;
+	self->maxCrd = NULL;
 }
 
 
@@ -134,7 +139,6 @@ void Mesh_RegularAlgorithms_SetMesh( void* algorithms, void* mesh ) {
 void Mesh_RegularAlgorithms_Update( void* algorithms ) {
 	Mesh_RegularAlgorithms*	self = (Mesh_RegularAlgorithms*)algorithms;
 	unsigned		nDims;
-	Grid*			eGrid;
 	int			ii;
 
 	assert( self && Stg_CheckType( self, Mesh_RegularAlgorithms ) );
@@ -148,27 +152,63 @@ void Mesh_RegularAlgorithms_Update( void* algorithms ) {
 	self->maxCrd = AllocArray( double, nDims );
 	Mesh_GetGlobalCoordRange( self->mesh, self->minCrd, self->maxCrd );
 
+	/* The grids belong to the mesh, we only keep references for the queries. */
+	self->elGrid = *Mesh_GetExtension( self->mesh, Grid**,  self->mesh->elGridId );
+	self->vertGrid = *Mesh_GetExtension( self->mesh, Grid**,  self->mesh->vertGridId );
+
 	self->sep = AllocArray( double, nDims );
-	eGrid = *Mesh_GetExtension( self->mesh, Grid**,  self->mesh->elGridId );
-	for( ii = 0; ii < nDims; ii++ )
-		self->sep[ii] = (self->maxCrd[ii] - self->minCrd[ii]) / eGrid->sizes[ii];
+	self->vertSep = AllocArray( double, nDims );
+	for( ii = 0; ii < nDims; ii++ ) {
+		self->sep[ii] = (self->maxCrd[ii] - self->minCrd[ii]) / self->elGrid->sizes[ii];
+		self->vertSep[ii] = (self->maxCrd[ii] - self->minCrd[ii]) / (self->vertGrid->sizes[ii] - 1);
+	}
+}
+
+unsigned Mesh_RegularAlgorithms_NearestVertex( void* algorithms, double* point ) {
+	Mesh_RegularAlgorithms*	self = (Mesh_RegularAlgorithms*)algorithms;
+	Mesh*			mesh;
+	unsigned		nDims;
+	unsigned		inds[3];
+	unsigned		global, vert;
+	double			out;
+	unsigned		d_i;
+
+	assert( self );
+	assert( self->vertGrid );
+	assert( Mesh_GetDimSize( self->mesh ) <= 3 );
+
+	/* Round to the closest vertex of the global grid, clamping to the boundaries. */
+	mesh = self->mesh;
+	nDims = Mesh_GetDimSize( mesh );
+	for( d_i = 0; d_i < nDims; d_i++ ) {
+		out = (point[d_i] - self->minCrd[d_i]) / self->vertSep[d_i] + 0.5;
+		if( !(out > 0.0) )
+			inds[d_i] = 0;
+		else if( out >= (double)(self->vertGrid->sizes[d_i] - 1) )
+			inds[d_i] = self->vertGrid->sizes[d_i] - 1;
+		else
+			inds[d_i] = (unsigned)out;
+	}
+
+	global = Grid_Project( self->vertGrid, inds );
+	if( Mesh_GlobalToDomain( mesh, 0, global, &vert ) )
+		return vert;
+
+	/* The closest vertex isn't stored here, so find the closest one we have. */
+	return self->nearestVertex( self, point );
 }
 
-Bool _Mesh_RegularAlgorithms_Search( void* algorithms, void* _mesh, double* point, 
-				     MeshTopology_Dim* dim, unsigned* ind )
+Bool Mesh_RegularAlgorithms_Search( void* algorithms, double* point, 
+				    MeshTopology_Dim* dim, unsigned* ind )
 {
 	Mesh_RegularAlgorithms*	self = (Mesh_RegularAlgorithms*)algorithms;
-	Mesh*			mesh = (Mesh*)_mesh;
 
 	assert( self );
-	assert( mesh );
 	assert( dim );
 	assert( ind );
 
-	/* TODO */
-	abort();
-
-	return False;
+	*dim = Mesh_GetDimSize( self->mesh );
+	return Mesh_RegularAlgorithms_SearchElements( self, point, ind );
 }
 
 Bool Mesh_RegularAlgorithms_SearchElements( void* algorithms, double* point, unsigned* elInd ) {
@@ -176,7 +216,6 @@ Bool Mesh_RegularAlgorithms_SearchElements( void* algorithms, double* point, uns
 	Mesh*			mesh;
 	unsigned		nDims;
 	unsigned		inds[3];
-	Grid			*elGrid;
 	double			out, frac, integer;
 	unsigned		d_i;
 
@@ -186,10 +225,9 @@ Bool Mesh_RegularAlgorithms_SearchElements( void* algorithms, double* point, uns
 
 	mesh = self->mesh;
 	nDims = Mesh_GetDimSize( mesh );
-	elGrid = *(Grid**)ExtensionManager_Get( mesh->info, mesh, mesh->elGridId );
 	for( d_i = 0; d_i < nDims; d_i++  ) {
 		if( Num_Approx( point[d_i] - self->maxCrd[d_i], 0.0 ) )
-			inds[d_i] = elGrid->sizes[d_i] - 1;
+			inds[d_i] = self->elGrid->sizes[d_i] - 1;
 		else if( point[d_i] < self->minCrd[d_i] || point[d_i] > self->maxCrd[d_i] )
 			return False;
 		else {
@@ -201,56 +239,10 @@ Bool Mesh_RegularAlgorithms_SearchElements( void* algorithms, double* point, uns
 		}
 	}
 
-	*elInd = Grid_Project( elGrid, inds );
+	*elInd = Grid_Project( self->elGrid, inds );
 	return Mesh_GlobalToDomain( mesh, nDims, *elInd, elInd );
 }
 
-double _Mesh_RegularAlgorithms_GetMinimumSeparation( void* algorithms, void* _mesh, double* perDim ) {
-	/* TODO */
-	abort();
-
-	return 0.0;
-}
-
-void _Mesh_RegularAlgorithms_GetLocalCoordRange( void* algorithms, void* _mesh, double* min, double* max ) {
-	Mesh_RegularAlgorithms*	self = (Mesh_RegularAlgorithms*)algorithms;
-	Mesh*			mesh = (Mesh*)_mesh;
-
-	assert( self );
-	assert( mesh );
-	assert( min );
-	assert( max );
-
-	/* TODO */
-	abort();
-}
-
-void _Mesh_RegularAlgorithms_GetDomainCoordRange( void* algorithms, void* _mesh, double* min, double* max ) {
-	Mesh_RegularAlgorithms*	self = (Mesh_RegularAlgorithms*)algorithms;
-	Mesh*			mesh = (Mesh*)_mesh;
-
-	assert( self );
-	assert( mesh );
-	assert( min );
-	assert( max );
-
-	/* TODO */
-	abort();
-}
-
-void _Mesh_RegularAlgorithms_GetGlobalCoordRange( void* algorithms, void* _mesh, double* min, double* max ) {
-	Mesh_RegularAlgorithms*	self = (Mesh_RegularAlgorithms*)algorithms;
-	Mesh*			mesh = (Mesh*)_mesh;
-
-	assert( self );
-	assert( mesh );
-	assert( min );
-	assert( max );
-
-	/* TODO */
-	abort();
-}
-
 
 /*--------------------------------------------------------------------------------------------------------------------------
 ** Public Functions
@@ -265,6 +257,7 @@ void Mesh_RegularAlgorithms_Destruct( Mesh_RegularAlgorithms* self ) {
 	assert( self && Stg_CheckType( self, Mesh_RegularAlgorithms ) );
 
 	KillArray( self->sep );
+	KillArray( self->vertSep );
 	KillArray( self->minCrd );
 	KillArray( self->maxCrd );
 }
@@ -24,7 +24,10 @@
 		/* Virtual info */			\
 							\
 		/* Mesh_RegularAlgorithms info */	\
+		Grid*		elGrid;			\
+		Grid*		vertGrid;		\
 		double*		sep;			\
+		double*		vertSep;		\
 		double*		minCrd;			\
 		double*		maxCrd;
 
@@ -80,19 +83,11 @@
 
 	void Mesh_RegularAlgorithms_Update( void* algorithms );
 
-	Bool Mesh_RegularAlgorithms_SearchElements( void* algorithms, double* point, unsigned* elInd );
-
-	#if 0 
-	Bool Mesh_RegularAlgorithms_Search( void* algorithms, void* mesh, double* point, MeshTopology_Dim* dim, unsigned* ind );
-
-	double Mesh_RegularAlgorithms_GetMinimumSeparation( void* algorithms, void* mesh, double* perDim );
+	unsigned Mesh_RegularAlgorithms_NearestVertex( void* algorithms, double* point );
 
-	void Mesh_RegularAlgorithms_GetLocalCoordRange( void* algorithms, void* mesh, double* min, double* max );
+	Bool Mesh_RegularAlgorithms_Search( void* algorithms, double* point, MeshTopology_Dim* dim, unsigned* ind );
 
-	void Mesh_RegularAlgorithms_GetDomainCoordRange( void* algorithms, void* mesh, double* min, double* max );
-
-	void Mesh_RegularAlgorithms_GetGlobalCoordRange( void* algorithms, void* mesh, double* min, double* max );
-	#endif 
+	Bool Mesh_RegularAlgorithms_SearchElements( void* algorithms, double* point, unsigned* elInd );
 
 	/*--------------------------------------------------------------------------------------------------------------------------
 	** Private Member functions
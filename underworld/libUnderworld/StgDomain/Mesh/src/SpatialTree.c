@@ -17,45 +17,11 @@
 #include "SpatialTree.h"
 
 
-#define GETNODECHILDREN( tree, node )		\
-  ((void**)(node))
-
-#define GETNODEORIGIN( tree, node )		\
-   ((double*)((stgByte*)(node) +		\
-	      (tree)->nChld * sizeof(void*)))
-
-#define SETNODEVERTS( tree, node, nVerts, verts )		\
-   ((int*)((stgByte*)(node) + (tree)->nChld * sizeof(void*) +	\
-	   (tree)->nDims * sizeof(double)))[0] = (nVerts);	\
-   ((int**)((stgByte*)(node) + (tree)->nChld * sizeof(void*) +	\
-	    (tree)->nDims * sizeof(double) +			\
-	    sizeof(int)))[0] = (verts)
-
-#define GETNODEVERTARRAY( tree, node )				\
-   ((int**)((stgByte*)(node) + (tree)->nChld * sizeof(void*) +	\
-	    (tree)->nDims * sizeof(double) +			\
-	    sizeof(int)))[0]
-
-#define GETNODENUMVERTS( tree, node )				\
-   ((int*)((stgByte*)(node) + (tree)->nChld * sizeof(void*) +	\
-	   (tree)->nDims * sizeof(double)))[0]
-
-
 const Type SpatialTree_Type = "SpatialTree";
 
 
-void SpatialTree_DestroyNode( SpatialTree* self, void* node );
-void SpatialTree_SplitSet( SpatialTree* self, double* orig,
-			   int nVerts, int* verts, 
-			   int* subSizes, int** subSets,
-			   Bool store );
-void SpatialTree_SplitNode( SpatialTree* self, void* node, void** parent,
-			    double* min, double* max,
-			    int nVerts, int* verts );
-void SpatialTree_BuildElements( SpatialTree* self, int nVerts, int* verts, 
-				int* nEls, int** els );
-void SpatialTree_SearchNode( SpatialTree* self, void* node, 
-			     const double* pnt, int* nEls, int** els );
+int SpatialTree_CellCoord( SpatialTree* self, int dim, double crd );
+void SpatialTree_BuildCells( SpatialTree* self );
 
 
 SpatialTree* SpatialTree_New() {
@@ -90,21 +56,24 @@ void _SpatialTree_Init( void* _self ) {
    self->nDims = 0;
    self->min = NULL;
    self->max = NULL;
-   self->root = NULL;
-   self->tol = 10;
-   self->nNodes = 0;
+   self->res = NULL;
+   self->invWidth = NULL;
+   self->nCells = 0;
+   self->cellOffs = NULL;
+   self->cellEls = NULL;
+   self->tol = 2;
+   self->version = 0;
 }
 
 void SpatialTree_Destruct( SpatialTree* self ) {
-   if( self->root )
-      SpatialTree_DestroyNode( self, self->root );
+   SpatialTree_Clear( self );
 }
 
 void _SpatialTree_Delete( void* _self ) {
    SpatialTree* self = (SpatialTree*)_self;
 
    SpatialTree_Destruct( self );
-   Stg_Class_Delete( self );
+   _Stg_Class_Delete( self );
 }
 
 void SpatialTree_Copy( void* _self, const void* _op ) {
@@ -123,7 +92,8 @@ void SpatialTree_SetMesh( void* _self, void* mesh ) {
 
 void SpatialTree_Rebuild( void* _self ) {
    SpatialTree* self = (SpatialTree*)_self;
-   int nVerts, *verts;
+   double vol, width;
+   int nEls, nCells, nSpan;
    int ii;
 
    if( !self->mesh )
@@ -131,229 +101,190 @@ void SpatialTree_Rebuild( void* _self ) {
 
    SpatialTree_Clear( self );
    self->nDims = Mesh_GetDimSize( self->mesh );
-   self->nChld = 2;
-   for( ii = 1; ii < self->nDims; ii++ )
-      self->nChld *= 2;
-
    self->min = AllocArray( double, self->nDims );
    self->max = AllocArray( double, self->nDims );
-
+   self->res = AllocArray( int, self->nDims );
+   self->invWidth = AllocArray( double, self->nDims );
    Mesh_GetDomainCoordRange( self->mesh, self->min, self->max );
-   nVerts = Mesh_GetDomainSize( self->mesh, 0 );
-   verts = AllocArray( int, nVerts );
-   for( ii = 0; ii < nVerts; ii++ )
-      verts[ii] = ii;
-   self->root = AllocArray( stgByte, self->nChld * sizeof(void*) + 
-			     self->nDims * sizeof(double) );
-   SpatialTree_SplitNode( self, self->root, &self->root,
-			  self->min, self->max, nVerts, verts );
+
+   /* Size the cells so there are roughly 'tol' elements per cell, keeping them as close
+      to square as the domain range allows. Degenerate dimensions get a single cell. */
+   nEls = Mesh_GetDomainSize( self->mesh, self->nDims );
+   nCells = nEls / self->tol;
+   if( nCells < 1 )
+      nCells = 1;
+   vol = 1.0;
+   nSpan = 0;
+   for( ii = 0; ii < self->nDims; ii++ ) {
+      if( self->max[ii] > self->min[ii] ) {
+	 vol *= self->max[ii] - self->min[ii];
+	 nSpan++;
+      }
+   }
+   width = nSpan ? pow( vol / (double)nCells, 1.0 / (double)nSpan ) : 0.0;
+   self->nCells = 1;
+   for( ii = 0; ii < self->nDims; ii++ ) {
+      if( self->max[ii] > self->min[ii] && width > 0.0 ) {
+	 self->res[ii] = (int)ceil( (self->max[ii] - self->min[ii]) / width );
+	 if( self->res[ii] > nCells )
+	    self->res[ii] = nCells;
+	 if( self->res[ii] < 1 )
+	    self->res[ii] = 1;
+	 self->invWidth[ii] = (double)self->res[ii] / (self->max[ii] - self->min[ii]);
+      }
+      else {
+	 self->res[ii] = 1;
+	 self->invWidth[ii] = 0.0;
+      }
+      self->nCells *= self->res[ii];
+   }
+
+   SpatialTree_BuildCells( self );
+   self->version = self->mesh->geometryVersion;
 }
 
 Bool SpatialTree_Search( void* _self, const double* pnt, int* nEls, int** els ) {
    SpatialTree* self = (SpatialTree*)_self;
+   int cell, stride;
    int ii;
 
+   if( !self->cellOffs || self->version != self->mesh->geometryVersion )
+      SpatialTree_Rebuild( self );
+
+   cell = 0;
+   stride = 1;
    for( ii = 0; ii < self->nDims; ii++ ) {
       if( pnt[ii] < self->min[ii] || pnt[ii] > self->max[ii] )
 	 return False;
+      cell += stride * SpatialTree_CellCoord( self, ii, pnt[ii] );
+      stride *= self->res[ii];
    }
 
-   SpatialTree_SearchNode( self, self->root, pnt, nEls, els );
+   *nEls = self->cellOffs[cell + 1] - self->cellOffs[cell];
+   *els = self->cellEls + self->cellOffs[cell];
    return True;
 }
 
-void SpatialTree_Clear( void* _self ) {
+int SpatialTree_SearchMany( void* _self, int nPnts, const double* pnts, int* nEls, int** els ) {
    SpatialTree* self = (SpatialTree*)_self;
-
-   if( self->root ) {
-      SpatialTree_DestroyNode( self, self->root );
-      self->root = NULL;
-      self->nNodes = 0;
-   }
-
-
-   FreeArray( self->min ); self->min = NULL;
-   FreeArray( self->max ); self->max = NULL;
-}
-
-void SpatialTree_SplitNode( SpatialTree* self, void* node, void** parent,
-			    double* min, double* max,
-			    int nVerts, int* verts )
-{
+   int nFound = 0;
    int ii;
 
-   for( ii = 0; ii < self->nDims; ii++ )
-      GETNODEORIGIN( self, node )[ii] = min[ii] + (max[ii] - min[ii]) * 0.5;
-
-   if( nVerts <= self->tol ) {
-      int nEls, *els;
+   if( !self->cellOffs || self->version != self->mesh->geometryVersion )
+      SpatialTree_Rebuild( self );
 
-      node = (void*)ReallocArray( node, stgByte,
-				   self->nChld * sizeof(void*) + 
-				   self->nDims * sizeof(double) + 
-				   sizeof(int) + sizeof(int*) );
-      *parent = node;
-      memset( node, 0, self->nChld * sizeof(void*) );
-
-      SpatialTree_BuildElements( self, nVerts, verts, 
-				 &nEls, &els );
-      FreeArray( verts );
-      SETNODEVERTS( self, node, nEls, els );
-   }
-   else {
-      void *newNode, *newNodePtr;
-      int* subSizes;
-      int** subSets;
-      double *subMin, *subMax;
-      int jj;
-
-      for( ii = 0; ii < self->nChld; ii++ ) {
-	 newNode = AllocArray( stgByte, self->nChld * sizeof(void*) + 
-				self->nDims * sizeof(double) );
-	 GETNODECHILDREN( self, node )[ii] = newNode;
+   for( ii = 0; ii < nPnts; ii++ ) {
+      if( SpatialTree_Search( self, pnts + ii * self->nDims, nEls + ii, els + ii ) )
+	 nFound++;
+      else {
+	 nEls[ii] = 0;
+	 els[ii] = NULL;
       }
+   }
 
-      subSizes = AllocArray( int, self->nChld );
-      SpatialTree_SplitSet( self, GETNODEORIGIN( self, node ),
-			    nVerts, verts, subSizes, NULL, False );
-
-      subSets = AllocArray( int*, self->nChld );
-      for( ii = 0; ii < self->nChld; ii++ )
-	 subSets[ii] = AllocArray( int, subSizes[ii] );
-      SpatialTree_SplitSet( self, GETNODEORIGIN( self, node ),
-			    nVerts, verts, subSizes, subSets, True );
-
-      FreeArray( verts );
-
-      subMin = AllocArray( double, self->nDims );
-      subMax = AllocArray( double, self->nDims );
-
-      for( ii = 0; ii < self->nChld; ii++ ) {
-	 for( jj = 0; jj < self->nDims; jj++ ) {
-	    if( ii & (1 << jj) ) {
-	       subMin[jj] = GETNODEORIGIN( self, node )[jj];
-	       subMax[jj] = max[jj];
-	    }
-	    else {
-	       subMin[jj] = min[jj];
-	       subMax[jj] = GETNODEORIGIN( self, node )[jj];
-	    }
-	 }
+   return nFound;
+}
 
-	 newNode = GETNODECHILDREN( self, node )[ii];
-	 newNodePtr = GETNODECHILDREN( self, node ) + ii;
-	 SpatialTree_SplitNode( self, newNode, newNodePtr, subMin, subMax,
-				subSizes[ii], subSets[ii] );
-      }
+void SpatialTree_Clear( void* _self ) {
+   SpatialTree* self = (SpatialTree*)_self;
 
-      FreeArray( subMin );
-      FreeArray( subMax );
-   }
+   FreeArray( self->min ); self->min = NULL;
+   FreeArray( self->max ); self->max = NULL;
+   FreeArray( self->res ); self->res = NULL;
+   FreeArray( self->invWidth ); self->invWidth = NULL;
+   FreeArray( self->cellOffs ); self->cellOffs = NULL;
+   FreeArray( self->cellEls ); self->cellEls = NULL;
+   self->nCells = 0;
 }
 
-void SpatialTree_SplitSet( SpatialTree* self, double* orig,
-			   int nVerts, int* verts, 
-			   int* subSizes, int** subSets,
-			   Bool store )
-{
-   double* crd;
-   int code;
-   int ii, jj;
-
-   memset( subSizes, 0, self->nChld * sizeof(int) );
-   for( ii = 0; ii < nVerts; ii++ ) {
-      crd = Mesh_GetVertex( self->mesh, verts[ii] );
-      code = 0;
-      for( jj = 0; jj < self->nDims; jj++ ) {
-	 if( crd[jj] > orig[jj] )
-	    code |= 1 << jj;
-      }
-
-      if( store )
-	 subSets[code][subSizes[code]++] = verts[ii];
-      else
-	 subSizes[code]++;
-   }
+int SpatialTree_CellCoord( SpatialTree* self, int dim, double crd ) {
+   int ijk;
+
+   /* The same monotonic mapping is used for points and element bounds, so any point inside
+      an element's bounding box always falls in a cell which lists that element. */
+   ijk = (int)((crd - self->min[dim]) * self->invWidth[dim]);
+   if( ijk < 0 )
+      return 0;
+   if( ijk >= self->res[dim] )
+      return self->res[dim] - 1;
+   return ijk;
 }
 
-void SpatialTree_BuildElements( SpatialTree* self, int nVerts, int* verts, 
-				int* nEls, int** els )
-{
-   int maxEls, *curEls;
+void SpatialTree_BuildCells( SpatialTree* self ) {
+   int nDims = self->nDims;
+   int nEls, nVerts;
+   int *lo, *hi, *curs;
+   int lower[3], upper[3], res[3];
+   const int* verts;
    IArray* inc;
-   int nIncEls, *incEls;
-   int ii, jj, kk;
-
-   maxEls = 0;
-   for( ii = 0; ii < nVerts; ii++ )
-      maxEls += Mesh_GetIncidenceSize( self->mesh, 0, verts[ii], self->nDims );
-
-   curEls = AllocArray( int, maxEls );
-
+   double* crd;
+   int ii, jj, kk, e_i, v_i, d_i;
+
+   nEls = Mesh_GetDomainSize( self->mesh, nDims );
+   lo = AllocArray( int, nEls * nDims );
+   hi = AllocArray( int, nEls * nDims );
+   self->cellOffs = AllocArray( int, self->nCells + 1 );
+   memset( self->cellOffs, 0, (self->nCells + 1) * sizeof(int) );
+   for( d_i = 0; d_i < 3; d_i++ )
+      res[d_i] = (d_i < nDims) ? self->res[d_i] : 1;
+
+   /* First pass: the range of cells covered by each element's bounding box, and the
+      number of elements listed in each cell. */
    inc = IArray_New();
-   maxEls = 0;
-   for( ii = 0; ii < nVerts; ii++ ) {
-      Mesh_GetIncidence( self->mesh, 0, verts[ii], self->nDims, inc );
-      nIncEls = IArray_GetSize( inc );
-      incEls = IArray_GetPtr( inc );
-      for( jj = 0; jj < nIncEls; jj++ ) {
-	 for( kk = 0; kk < maxEls; kk++ ) {
-	    if( curEls[kk] == incEls[jj] )
-	       break;
+   for( e_i = 0; e_i < nEls; e_i++ ) {
+      Mesh_GetIncidence( self->mesh, nDims, e_i, MT_VERTEX, inc );
+      nVerts = IArray_GetSize( inc );
+      verts = IArray_GetPtr( inc );
+      for( d_i = 0; d_i < 3; d_i++ ) {
+	 lower[d_i] = 0;
+	 upper[d_i] = 0;
+      }
+      for( d_i = 0; d_i < nDims; d_i++ ) {
+	 double elMin, elMax;
+
+	 elMin = elMax = Mesh_GetVertex( self->mesh, verts[0] )[d_i];
+	 for( v_i = 1; v_i < nVerts; v_i++ ) {
+	    crd = Mesh_GetVertex( self->mesh, verts[v_i] );
+	    if( crd[d_i] < elMin )
+	       elMin = crd[d_i];
+	    else if( crd[d_i] > elMax )
+	       elMax = crd[d_i];
+	 }
+	 lower[d_i] = lo[e_i * nDims + d_i] = SpatialTree_CellCoord( self, d_i, elMin );
+	 upper[d_i] = hi[e_i * nDims + d_i] = SpatialTree_CellCoord( self, d_i, elMax );
+      }
+      for( kk = lower[2]; kk <= upper[2]; kk++ ) {
+	 for( jj = lower[1]; jj <= upper[1]; jj++ ) {
+	    for( ii = lower[0]; ii <= upper[0]; ii++ )
+	       self->cellOffs[(kk * res[1] + jj) * res[0] + ii + 1]++;
 	 }
-	 if( kk == maxEls )
-	    curEls[maxEls++] = incEls[jj];
       }
    }
    Stg_Class_Delete( inc );
 
-   *nEls = maxEls;
-   *els = ReallocArray( curEls, int, maxEls );
-}
-
-void SpatialTree_SearchNode( SpatialTree* self, void* node, 
-			     const double* pnt, int* nEls, int** els )
-{
-   if( GETNODECHILDREN( self, node )[0] == NULL ) {
-      *nEls = GETNODENUMVERTS( self, node );
-      *els = GETNODEVERTARRAY( self, node );
-   }
-   else {
-      double* orig;
-      int code;
-      int ii;
-
-      orig = GETNODEORIGIN( self, node );
-      code = 0;
-      for( ii = 0; ii < self->nDims; ii++ ) {
-	 if( pnt[ii] > orig[ii] )
-	    code |= 1 << ii;
+   for( ii = 0; ii < self->nCells; ii++ )
+      self->cellOffs[ii + 1] += self->cellOffs[ii];
+
+   /* Second pass: elements are visited in order, so each cell's list is sorted. */
+   self->cellEls = AllocArray( int, self->cellOffs[self->nCells] );
+   curs = AllocArray( int, self->nCells );
+   memcpy( curs, self->cellOffs, self->nCells * sizeof(int) );
+   for( e_i = 0; e_i < nEls; e_i++ ) {
+      for( d_i = 0; d_i < 3; d_i++ ) {
+	 lower[d_i] = (d_i < nDims) ? lo[e_i * nDims + d_i] : 0;
+	 upper[d_i] = (d_i < nDims) ? hi[e_i * nDims + d_i] : 0;
+      }
+      for( kk = lower[2]; kk <= upper[2]; kk++ ) {
+	 for( jj = lower[1]; jj <= upper[1]; jj++ ) {
+	    for( ii = lower[0]; ii <= upper[0]; ii++ ) {
+	       int cell = (kk * res[1] + jj) * res[0] + ii;
+	       self->cellEls[curs[cell]++] = e_i;
+	    }
+	 }
       }
-
-      SpatialTree_SearchNode( self, GETNODECHILDREN( self, node )[code], 
-			      pnt, nEls, els );
-   }
-}
-
-void SpatialTree_DestroyNode( SpatialTree* self, void* node ) {
-   Bool leaf;
-   int ii;
-
-   if( !node )
-      return;
-
-   leaf = True;
-   for( ii = 0; ii < self->nChld; ii++ ) {
-      if( GETNODECHILDREN( self, node )[ii] )
-	 leaf = False;
-      SpatialTree_DestroyNode( self, GETNODECHILDREN( self, node )[ii] );
-   }
-
-   if( leaf ) {
-      FreeArray( GETNODEVERTARRAY( self, node ) );
    }
 
-   FreeArray( node );
+   FreeArray( curs );
+   FreeArray( lo );
+   FreeArray( hi );
 }
-
-
@@ -12,17 +12,24 @@
 #define __StgDomain_Mesh_SpatialTree_h__
 
 extern const Type SpatialTree_Type;
-        
+
+/* The spatial index is stored flat: the domain coordinate range is divided into a regular
+   grid of cells, and each cell lists (in increasing order) the domain elements whose bounding
+   box overlaps it. The lists are packed into a single array, indexed by the cell offsets. The
+   index is rebuilt lazily by searches whenever the mesh geometry version has changed. */
 #define __SpatialTree                           \
     __Stg_Class                                 \
     Mesh* mesh;                                 \
     int nDims;                                  \
     double* min;                                \
     double* max;                                \
-    int nChld;                                  \
-    void* root;                                 \
+    int* res;                                   \
+    double* invWidth;                           \
+    int nCells;                                 \
+    int* cellOffs;                              \
+    int* cellEls;                               \
     int tol;                                    \
-    int nNodes;
+    unsigned version;
 
 struct SpatialTree { __SpatialTree };
 
@@ -56,6 +63,10 @@ void SpatialTree_Rebuild( void* _self );
 
 Bool SpatialTree_Search( void* _self, const double* pnt, int* nEls, int** els );
 
+/* Batched search; on return nEls[i] and els[i] hold the candidate elements for point i (with
+   nEls[i] zero for points outside the domain range). Returns the number of points inside. */
+int SpatialTree_SearchMany( void* _self, int nPnts, const double* pnts, int* nEls, int** els );
+
 void SpatialTree_Clear( void* _self );
 
 #endif /* __StgDomain_Mesh_SpatialTree_h__ */
@@ -126,6 +126,11 @@ void Sync_SetDecomp( void* _self, const Decomp* decomp ) {
    }
 }
 
+/*
+ * Sets up the remotes when their owners are unknown, finding them through the decomposition's
+ * owner directory and an exchange of flags with every rank. Structured meshes set their
+ * neighbours and remotes directly instead, through Sync_SetComm and Sync_AddRemotes.
+ */
 void Sync_FindRemotes( void* _self, int nRemotes, const int* remotes ) {
    Sync *self = (Sync*)_self;
    int *owners;
@@ -528,10 +533,7 @@ void Sync_UpdateTables( Sync* self ) {
 	 self->srcs[n_i][s_i] = Sync_GlobalToRemote( self, 
 						     self->srcs[n_i][s_i] ); 
       }
-      for( s_i = 0; s_i < self->nSnks[n_i]; s_i++ ) {
-	 self->snks[n_i][s_i] = Decomp_GlobalToLocal( self->decomp, 
-						      self->snks[n_i][s_i] );
-      }
+      Decomp_GlobalsToLocals( self->decomp, self->nSnks[n_i], self->snks[n_i] );
    }
 }
 
@@ -375,12 +375,78 @@ void CartesianGeneratorSuite_TestFaceVertexInc( CartesianGeneratorSuiteData* dat
 
    Stg_Class_Delete( inc );
 }
+void CartesianGeneratorSuite_TestImplicitElementVertexInc( CartesianGeneratorSuiteData* data ) {
+   IGraph*  topo = (IGraph*)data->mesh->topo;
+   unsigned dim = Mesh_GetDimSize( data->mesh );
+   unsigned nEls = Mesh_GetDomainSize( data->mesh, dim );
+   IArray*  inc = IArray_New();
+   int*     implicitVerts;
+   SizeT    implicitMem, explicitMem;
+   unsigned el_i, inc_i;
+   Bool     match;
+
+   /* A regular decomposition stores the element to vertex incidence implicitly. */
+   pcu_check_true( topo->implicitInc != NULL );
+   pcu_check_true( Mesh_HasIncidence( data->mesh, dim, MT_VERTEX ) );
+   implicitMem = Mesh_GetIncidenceMemory( data->mesh, dim, MT_VERTEX );
+
+   implicitVerts = AllocArray( int, nEls * 8 );
+   for( el_i = 0; el_i < nEls; el_i++ ) {
+      pcu_check_true( Mesh_GetIncidenceSize( data->mesh, dim, el_i, MT_VERTEX ) == 8 );
+      Mesh_GetIncidence( data->mesh, dim, el_i, MT_VERTEX, inc );
+      memcpy( implicitVerts + el_i * 8, IArray_GetPtr( inc ), 8 * sizeof(int) );
+   }
+
+   /* The explicit lists built on demand match, and take more memory. */
+   Mesh_MaterialiseIncidence( data->mesh, dim, MT_VERTEX );
+   pcu_check_true( topo->implicitInc == NULL );
+   explicitMem = Mesh_GetIncidenceMemory( data->mesh, dim, MT_VERTEX );
+   pcu_check_true( explicitMem > implicitMem );
+
+   match = True;
+   for( el_i = 0; el_i < nEls; el_i++ ) {
+      Mesh_GetIncidence( data->mesh, dim, el_i, MT_VERTEX, inc );
+      for( inc_i = 0; inc_i < 8; inc_i++ ) {
+         if( IArray_GetPtr( inc )[inc_i] != implicitVerts[el_i * 8 + inc_i] )
+            match = False;
+      }
+   }
+   pcu_check_true( match );
+
+   FreeArray( implicitVerts );
+   Stg_Class_Delete( inc );
+}
+
+void CartesianGeneratorSuite_TestNeighbourOnlySetup( CartesianGeneratorSuiteData* data ) {
+   IGraph*       topo = (IGraph*)data->mesh->topo;
+   unsigned      dim = Mesh_GetDimSize( data->mesh );
+   const Sync*   sync;
+   const Decomp* decomp;
+   unsigned      d_i;
+
+   /* The neighbours are those adjacent in the processor grid. */
+   pcu_check_true( Comm_GetNumNeighbours( MeshTopology_GetComm( topo ) ) <= 26 );
+
+   /* The shadows are found through the neighbours alone, so the owner directory,
+      which needs an exchange with every rank, is never built. */
+   for( d_i = 0; d_i <= dim; d_i++ ) {
+      if( d_i != 0 && d_i != dim )
+         continue;
+      sync = IGraph_GetDomain( topo, d_i );
+      decomp = Sync_GetDecomp( sync );
+      pcu_check_true( !decomp->ownersValid );
+      pcu_check_true( Sync_GetComm( sync ) == MeshTopology_GetComm( topo ) );
+   }
+}
+
 void CartesianGeneratorSuite( pcu_suite_t* suite ) {
    pcu_suite_setData( suite, CartesianGeneratorSuiteData );
    pcu_suite_setFixtures( suite, CartesianGeneratorSuite_Setup, CartesianGeneratorSuite_Teardown );
    pcu_suite_addTest( suite, CartesianGeneratorSuite_TestElementVertexInc );
    pcu_suite_addTest( suite, CartesianGeneratorSuite_TestEdgeVertexInc );
    pcu_suite_addTest( suite, CartesianGeneratorSuite_TestFaceVertexInc );
+   pcu_suite_addTest( suite, CartesianGeneratorSuite_TestImplicitElementVertexInc );
+   pcu_suite_addTest( suite, CartesianGeneratorSuite_TestNeighbourOnlySetup );
 }
 
 
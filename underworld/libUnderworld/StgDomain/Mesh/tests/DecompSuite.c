@@ -9,6 +9,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "pcu/pcu.h"
 #include <StGermain/libStGermain/src/StGermain.h> 
@@ -48,6 +49,8 @@ void DecompSuite_TestDecomp( DecompSuiteData* data ) {
    for( l_i = 0; l_i < nLocs; l_i++ )
       locs[l_i] = data->rank * nLocs + l_i;
    pcu_check_noassert( Decomp_SetLocals( decomp, nLocs, locs ) );
+   pcu_check_true( !decomp->ownersValid );
+   pcu_check_noassert( Decomp_UpdateOwnerMap( decomp ) );
    for( g_i = 0; g_i < data->nProcs * nLocs; g_i++ ) {
       if( g_i >= data->rank * nLocs && g_i < (data->rank + 1) * nLocs ) {
          pcu_check_true( IMap_Map( decomp->owners, g_i ) == data->rank );
@@ -61,6 +64,8 @@ void DecompSuite_TestDecomp( DecompSuiteData* data ) {
       locs[l_i] = (data->rank * nLocs + nLocs / 2 + l_i) % (data->nProcs * nLocs);
    }
    pcu_check_noassert( Decomp_SetLocals( decomp, nLocs, locs ) );
+   pcu_check_true( !decomp->ownersValid );
+   pcu_check_noassert( Decomp_UpdateOwnerMap( decomp ) );
    for( g_i = 0; g_i < data->nProcs * nLocs; g_i++ ) {
       if( g_i >= data->rank * nLocs && g_i < (data->rank + 1) * nLocs ) {
          if( g_i < data->rank * nLocs + nLocs / 2 ) {
@@ -85,16 +90,79 @@ void DecompSuite_TestDecomp( DecompSuiteData* data ) {
    for( g_i = 0; g_i < data->nProcs * nLocs; g_i++ )
       locs[g_i] = g_i;
    pcu_check_noassert( Decomp_FindOwners( decomp, data->nProcs * nLocs, locs, ranks ) );
+   for( g_i = 0; g_i < data->nProcs * nLocs; g_i++ ) {
+      pcu_check_true( ranks[g_i] == ((g_i + data->nProcs * nLocs - nLocs / 2) % (data->nProcs * nLocs)) / nLocs );
+   }
+
+   /* The owner directory is rebuilt on demand after the locals change. */
+   for( l_i = 0; l_i < nLocs; l_i++ )
+      locs[l_i] = data->rank * nLocs + l_i;
+   pcu_check_noassert( Decomp_SetLocals( decomp, nLocs, locs ) );
+   pcu_check_true( !decomp->ownersValid );
+   for( g_i = 0; g_i < data->nProcs * nLocs; g_i++ )
+      locs[g_i] = g_i;
+   pcu_check_noassert( Decomp_FindOwners( decomp, data->nProcs * nLocs, locs, ranks ) );
+   pcu_check_true( decomp->ownersValid );
+   for( g_i = 0; g_i < data->nProcs * nLocs; g_i++ ) {
+      pcu_check_true( ranks[g_i] == g_i / nLocs );
+   }
 
    Stg_Class_Delete( decomp );
    MemFree( locs );
    MemFree( ranks );
 }
 
+void DecompSuite_TestGlobalToLocal( DecompSuiteData* data ) {
+   Decomp* decomp;
+   int     nLocs = 18, nAdded = 6;
+   int     order[] = { 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 17, 14, 16, 0, 1, 2, 3 };
+   int     addedOrder[] = { 4, 5, 0, 1, 2, 3 };
+   int     *locs, *inds;
+   int     local;
+   int     l_i;
+
+   locs = MemArray( int, nLocs + nAdded, "testDecomp" );
+   inds = MemArray( int, nLocs + nAdded, "testDecomp" );
+   for( l_i = 0; l_i < nLocs; l_i++ )
+      locs[l_i] = data->rank * nLocs + order[l_i];
+
+   /* The two runs are stored as ranges and the four scattered locals hashed. */
+   decomp = Decomp_New();
+   pcu_check_noassert( Decomp_SetLocals( decomp, nLocs, locs ) );
+   pcu_check_true( decomp->nRuns == 2 );
+   pcu_check_true( IMap_GetSize( decomp->inv ) == 4 );
+   for( l_i = 0; l_i < nLocs; l_i++ ) {
+      pcu_check_true( Decomp_GlobalToLocal( decomp, locs[l_i] ) == l_i );
+      pcu_check_true( Decomp_TryGlobalToLocal( decomp, locs[l_i], &local ) && local == l_i );
+   }
+   if( data->nProcs > 1 ) {
+      pcu_check_true( !Decomp_TryGlobalToLocal( decomp, ((data->rank + 1) % data->nProcs) * nLocs, &local ) );
+      pcu_check_true( !Decomp_TryGlobalToLocal( decomp, ((data->rank + 1) % data->nProcs) * nLocs + 15, &local ) );
+   }
+
+   /* Added locals follow the existing ones, the short run being hashed. */
+   for( l_i = 0; l_i < nAdded; l_i++ )
+      locs[nLocs + l_i] = data->nProcs * nLocs + data->rank * nAdded + addedOrder[l_i];
+   pcu_check_noassert( Decomp_AddLocals( decomp, nAdded, locs + nLocs ) );
+   pcu_check_true( decomp->nRuns == 3 );
+   pcu_check_true( IMap_GetSize( decomp->inv ) == 6 );
+   memcpy( inds, locs, (nLocs + nAdded) * sizeof(int) );
+   pcu_check_noassert( Decomp_GlobalsToLocals( decomp, nLocs + nAdded, inds ) );
+   for( l_i = 0; l_i < nLocs + nAdded; l_i++ ) {
+      pcu_check_true( inds[l_i] == l_i );
+   }
+   pcu_check_true( Decomp_GetInverseMemory( decomp ) >= 9 * sizeof(int) + 6 * sizeof(IMapItem) );
+
+   Stg_Class_Delete( decomp );
+   MemFree( locs );
+   MemFree( inds );
+}
+
 void DecompSuite( pcu_suite_t* suite ) {
    pcu_suite_setData( suite, DecompSuiteData );
    pcu_suite_setFixtures( suite, DecompSuite_Setup, DecompSuite_Teardown );
    pcu_suite_addTest( suite, DecompSuite_TestDecomp );
+   pcu_suite_addTest( suite, DecompSuite_TestGlobalToLocal );
 }
 
 
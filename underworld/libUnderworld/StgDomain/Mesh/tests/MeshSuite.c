@@ -229,6 +229,121 @@ void MeshSuite_TestMeshSearch( MeshSuiteData* data ) {
    pcu_check_true( ii == Mesh_GetLocalSize( mesh, 0 ) );
 }
 
+void MeshSuite_TestRegularAlgorithms( MeshSuiteData* data ) {
+   CartesianGenerator*     gen;
+   Mesh*                   mesh;
+   Mesh_RegularAlgorithms* regular;
+   Mesh_Algorithms*        generic;
+   int                     nDims;
+   int                     sizes[3];
+   double                  minCrd[3];
+   double                  maxCrd[3];
+   double                  localMin[3];
+   double                  localMax[3];
+   double                  point[3];
+   int                     el, genEl;
+   int                     d_i, p_i;
+
+   /* Uneven sizes so some ranks have more elements than others. */
+   sizes[0] = 3 * data->nProcs + 1;
+   sizes[1] = 2 * data->nProcs + 1;
+   sizes[2] = data->nProcs + 2;
+   minCrd[0] = minCrd[1] = minCrd[2] = 0.0;
+   maxCrd[0] = maxCrd[1] = maxCrd[2] = (double)data->nProcs;
+
+   nDims = 3;
+   gen = CartesianGenerator_New( "", NULL );
+   MeshGenerator_SetDimSize( gen, nDims );
+   CartesianGenerator_SetShadowDepth( gen, 1 );
+   CartesianGenerator_SetTopologyParams( gen, sizes, 0, NULL, NULL );
+   CartesianGenerator_SetGeometryParams( gen, minCrd, maxCrd );
+   mesh = Mesh_New( "" );
+   Mesh_SetGenerator( mesh, gen );
+   Stg_Component_Build( mesh, NULL, False );
+
+   regular = (Mesh_RegularAlgorithms*)mesh->algorithms;
+   pcu_check_true( Stg_Class_IsInstance( regular, Mesh_RegularAlgorithms_Type ) );
+
+   /* Compare element search and nearest vertex with the generic algorithms at random points. */
+   generic = Mesh_Algorithms_New( "", NULL );
+   Mesh_Algorithms_SetMesh( generic, mesh );
+   Mesh_Algorithms_Update( generic );
+   Mesh_GetLocalCoordRange( mesh, localMin, localMax );
+   srand( data->rank + 1 );
+   for( p_i = 0; p_i < 1000; p_i++ ) {
+      for( d_i = 0; d_i < nDims; d_i++ )
+         point[d_i] = localMin[d_i] + (localMax[d_i] - localMin[d_i]) * (double)rand() / (double)RAND_MAX;
+      if( !Mesh_SearchElements( mesh, point, &el ) )
+         break;
+      if( !Mesh_Algorithms_SearchElements( generic, point, &genEl ) || el != genEl )
+         break;
+      if( Mesh_NearestVertex( mesh, point ) != Mesh_Algorithms_NearestVertex( generic, point ) )
+         break;
+   }
+   pcu_check_true( p_i == 1000 );
+
+   FreeObject( generic );
+   FreeObject( gen );
+   FreeObject( mesh );
+}
+
+void MeshSuite_TestDeformationMetrics( MeshSuiteData* data ) {
+   CartesianGenerator* gen;
+   Mesh*               mesh;
+   int                 nDims;
+   int                 sizes[3];
+   double              minCrd[3];
+   double              maxCrd[3];
+   double              min[3], max[3];
+   double              algMin[3], algMax[3];
+   double              sep, algSep;
+   double*             vert;
+   int                 it, v_i, d_i;
+
+   sizes[0] = sizes[1] = sizes[2] = 4 * data->nProcs;
+   minCrd[0] = minCrd[1] = minCrd[2] = 0.0;
+   maxCrd[0] = maxCrd[1] = maxCrd[2] = (double)data->nProcs;
+
+   nDims = 2;
+   gen = CartesianGenerator_New( "", NULL );
+   MeshGenerator_SetDimSize( gen, nDims );
+   CartesianGenerator_SetShadowDepth( gen, 1 );
+   CartesianGenerator_SetTopologyParams( gen, sizes, 0, NULL, NULL );
+   CartesianGenerator_SetGeometryParams( gen, minCrd, maxCrd );
+   mesh = Mesh_New( "" );
+   Mesh_SetGenerator( mesh, gen );
+   Stg_Component_Build( mesh, NULL, False );
+
+   /* Move every vertex, and then only the first one, comparing the metrics with the algorithms. */
+   for( it = 0; it < 2; it++ ) {
+      for( v_i = 0; v_i < (it ? 1 : Mesh_GetDomainSize( mesh, MT_VERTEX )); v_i++ ) {
+         vert = Mesh_GetVertex( mesh, v_i );
+         vert[0] -= 0.1 * vert[1] / (double)sizes[0];
+      }
+      Mesh_DeformationUpdate( mesh );
+
+      Mesh_GetMinimumSeparation( mesh, &sep, NULL );
+      algSep = Mesh_Algorithms_GetMinimumSeparation( mesh->algorithms, NULL );
+      pcu_check_true( sep == algSep );
+
+      Mesh_GetLocalCoordRange( mesh, min, max );
+      Mesh_Algorithms_GetLocalCoordRange( mesh->algorithms, algMin, algMax );
+      for( d_i = 0; d_i < nDims; d_i++ )
+         pcu_check_true( min[d_i] == algMin[d_i] && max[d_i] == algMax[d_i] );
+      Mesh_GetDomainCoordRange( mesh, min, max );
+      Mesh_Algorithms_GetDomainCoordRange( mesh->algorithms, algMin, algMax );
+      for( d_i = 0; d_i < nDims; d_i++ )
+         pcu_check_true( min[d_i] == algMin[d_i] && max[d_i] == algMax[d_i] );
+      Mesh_GetGlobalCoordRange( mesh, min, max );
+      Mesh_Algorithms_GetGlobalCoordRange( mesh->algorithms, algMin, algMax );
+      for( d_i = 0; d_i < nDims; d_i++ )
+         pcu_check_true( min[d_i] == algMin[d_i] && max[d_i] == algMax[d_i] );
+   }
+
+   FreeObject( gen );
+   FreeObject( mesh );
+}
+
 void MeshSuite( pcu_suite_t* suite ) {
    pcu_suite_setData( suite, MeshSuiteData );
    pcu_suite_setFixtures( suite, MeshSuite_Setup, MeshSuite_Teardown );
@@ -236,6 +351,8 @@ void MeshSuite( pcu_suite_t* suite ) {
    pcu_suite_addTest( suite, MeshSuite_TestMeshNearVert2D );
    pcu_suite_addTest( suite, MeshSuite_TestMeshNearVert3D );
    pcu_suite_addTest( suite, MeshSuite_TestMeshSearch );
+   pcu_suite_addTest( suite, MeshSuite_TestRegularAlgorithms );
+   pcu_suite_addTest( suite, MeshSuite_TestDeformationMetrics );
 }
 
 
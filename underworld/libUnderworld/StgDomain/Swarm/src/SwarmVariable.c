@@ -439,4 +439,105 @@ double SwarmVariable_GetCachedMaxGlobalMagnitude( void* swarmVariable ) {
    return self->magnitudeMax;
 }
 
+void SwarmVariable_WriteDataset( void* swarmVariable, const char* filename, long offset ) {
+	SwarmVariable*	self = (SwarmVariable*)swarmVariable;
+	StgVariable*	variable = self->variable;
+	MPI_Comm			comm = self->swarm->comm;
+	long				localCount, start = 0;
+	int				rank, ierr;
+	MPI_Datatype	rowType, memType;
+	MPI_File			fh;
+
+	StgVariable_Update( variable );
+	localCount = variable->arraySize;
+
+	/* The local particles are written as a single contiguous block of rows, in processor order. */
+	MPI_Comm_rank( comm, &rank );
+	MPI_Exscan( &localCount, &start, 1, MPI_LONG, MPI_SUM, comm );
+	if( rank == 0 )
+		start = 0;
+
+	/* Rows are written directly from the particle array, strided by the particle size. */
+	MPI_Type_contiguous( variable->dataSizes[0], MPI_BYTE, &rowType );
+	MPI_Type_create_hvector( localCount, 1, variable->structSize, rowType, &memType );
+	MPI_Type_commit( &memType );
+
+	ierr = MPI_File_open( comm, (char*)filename, MPI_MODE_WRONLY, MPI_INFO_NULL, &fh );
+	Journal_Firewall( ierr == MPI_SUCCESS, NULL,
+		"Error in func %s: unable to open file '%s' to write SwarmVariable '%s'.\n", __func__, filename, self->name );
+	MPI_File_write_at_all( fh, (MPI_Offset)offset + (MPI_Offset)start * variable->dataSizes[0],
+		(void*)( (ArithPointer)variable->arrayPtr + variable->offsets[0] ), localCount ? 1 : 0, memType, MPI_STATUS_IGNORE );
+	MPI_File_close( &fh );
+
+	MPI_Type_free( &memType );
+	MPI_Type_free( &rowType );
+}
+
+typedef struct {
+	long	row;
+	int	particle;
+} SwarmVariable_DatasetRow;
+
+static int _SwarmVariable_CompareDatasetRows( const void* a, const void* b ) {
+	long ra = ((const SwarmVariable_DatasetRow*)a)->row;
+	long rb = ((const SwarmVariable_DatasetRow*)b)->row;
+
+	return ( ra > rb ) - ( ra < rb );
+}
 
+void SwarmVariable_ReadDataset( void* swarmVariable, const char* filename, long offset, long* rows, int rowCount ) {
+	SwarmVariable*					self = (SwarmVariable*)swarmVariable;
+	StgVariable*						variable = self->variable;
+	MPI_Comm							comm = self->swarm->comm;
+	SwarmVariable_DatasetRow*	order;
+	MPI_Aint*						fileDisplacements;
+	MPI_Aint*						memDisplacements;
+	MPI_Datatype					rowType, fileType, memType;
+	MPI_File							fh;
+	int								row_I, ierr;
+
+	StgVariable_Update( variable );
+	Journal_Firewall( rowCount == (int)variable->arraySize, NULL,
+		"Error in func %s: %d rows provided for the %u local particles of SwarmVariable '%s'.\n",
+		__func__, rowCount, variable->arraySize, self->name );
+
+	/*
+	 * Particles may map to any rows of the dataset (eg. when restarting on a different number
+	 * of processors). MPI-IO requires increasing file displacements, so the rows are sorted and
+	 * read into the particles in the same order.
+	 */
+	order = Memory_Alloc_Array( SwarmVariable_DatasetRow, rowCount, "order" );
+	for( row_I = 0; row_I < rowCount; row_I++ ) {
+		order[row_I].row = rows[row_I];
+		order[row_I].particle = row_I;
+	}
+	qsort( order, rowCount, sizeof(SwarmVariable_DatasetRow), _SwarmVariable_CompareDatasetRows );
+
+	fileDisplacements = Memory_Alloc_Array( MPI_Aint, rowCount, "fileDisplacements" );
+	memDisplacements = Memory_Alloc_Array( MPI_Aint, rowCount, "memDisplacements" );
+	for( row_I = 0; row_I < rowCount; row_I++ ) {
+		fileDisplacements[row_I] = (MPI_Aint)order[row_I].row * variable->dataSizes[0];
+		memDisplacements[row_I] = (MPI_Aint)order[row_I].particle * variable->structSize;
+	}
+
+	MPI_Type_contiguous( variable->dataSizes[0], MPI_BYTE, &rowType );
+	MPI_Type_commit( &rowType );
+	MPI_Type_create_hindexed_block( rowCount, 1, fileDisplacements, rowType, &fileType );
+	MPI_Type_commit( &fileType );
+	MPI_Type_create_hindexed_block( rowCount, 1, memDisplacements, rowType, &memType );
+	MPI_Type_commit( &memType );
+
+	ierr = MPI_File_open( comm, (char*)filename, MPI_MODE_RDONLY, MPI_INFO_NULL, &fh );
+	Journal_Firewall( ierr == MPI_SUCCESS, NULL,
+		"Error in func %s: unable to open file '%s' to read SwarmVariable '%s'.\n", __func__, filename, self->name );
+	MPI_File_set_view( fh, (MPI_Offset)offset, rowType, fileType, "native", MPI_INFO_NULL );
+	MPI_File_read_all( fh, (void*)( (ArithPointer)variable->arrayPtr + variable->offsets[0] ), rowCount ? 1 : 0, memType, MPI_STATUS_IGNORE );
+	MPI_File_close( &fh );
+
+	MPI_Type_free( &memType );
+	MPI_Type_free( &fileType );
+	MPI_Type_free( &rowType );
+	Memory_Free( memDisplacements );
+	Memory_Free( fileDisplacements );
+	Memory_Free( order );
+}
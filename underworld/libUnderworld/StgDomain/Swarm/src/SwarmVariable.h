@@ -122,6 +122,16 @@
    double SwarmVariable_GetCachedMinGlobalMagnitude( void* swarmVariable );
    double SwarmVariable_GetCachedMaxGlobalMagnitude( void* swarmVariable );
 
+	/** Writes the values of the local particles to a contiguous (particleGlobalCount x dofCount)
+	 * dataset starting at byte offset 'offset' within an existing file, with each processor's
+	 * particles in a block of rows following those of the lower ranked processors. Collective. */
+	void SwarmVariable_WriteDataset( void* swarmVariable, const char* filename, long offset );
+
+	/** Reads the values of the local particles from the dataset rows given by 'rows' (one per
+	 * local particle), so the dataset may have been written using any number of processors.
+	 * Collective. */
+	void SwarmVariable_ReadDataset( void* swarmVariable, const char* filename, long offset, long* rows, int rowCount );
+
 	/*** Default Implementations ***/
 	void _SwarmVariable_ValueAtDouble( void* swarmVariable, Particle_Index lParticle_I, double* value );
 
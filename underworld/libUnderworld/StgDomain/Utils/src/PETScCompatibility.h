@@ -144,6 +144,7 @@ PetscErrorCode Stg_VecLoad(PetscViewer viewer, const VecType outtype,Vec *newvec
     #define Stg_PetscOptions PetscOptionItems
     #define PetscOptionsGetString(arg1, arg2, arg3, arg4, arg5) PetscOptionsGetString(NULL, arg1, arg2, arg3, arg4, arg5)
     #define PetscOptionsGetInt(arg1, arg2, arg3, arg4) PetscOptionsGetInt(NULL, arg1, arg2, arg3, arg4)
+    #define PetscOptionsGetReal(arg1, arg2, arg3, arg4) PetscOptionsGetReal(NULL, arg1, arg2, arg3, arg4)
     #define PetscOptionsHasName(arg1, arg2, arg3) PetscOptionsHasName(NULL, arg1, arg2, arg3)
     #define PetscOptionsInsertString(arg1) PetscOptionsInsertString(NULL, arg1)
     #define PetscOptionsClear() PetscOptionsClear(NULL)
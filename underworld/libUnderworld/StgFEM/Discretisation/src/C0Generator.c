@@ -202,6 +202,7 @@ void C0Generator_BuildGeometry( C0Generator* self, FeMesh* mesh ) {
 	unsigned		nDomainEls;
 	Mesh_ElementType*	elType;
 	unsigned		e_i;
+	const Bool*	moved;
 
 	assert( self );
 	assert( mesh );
@@ -209,15 +210,20 @@ void C0Generator_BuildGeometry( C0Generator* self, FeMesh* mesh ) {
 	elMesh = self->elMesh;
 	nDims = Mesh_GetDimSize( elMesh );
 	nDomainEls = Mesh_GetDomainSize( elMesh, nDims );
+	/* once generated, only the elements moved since the last generation need updating */
+	moved = mesh->vertices ? Mesh_GetMovedElements( elMesh, mesh->parentMeshVersion ) : NULL;
     Mesh_GenerateVertices( mesh, nDomainEls, nDims );
 	centroid = AllocArray( double, nDims );
 	for( e_i = 0; e_i < nDomainEls; e_i++ ) {
+		if( moved && !moved[e_i] )
+			continue;
 		elType = Mesh_GetElementType( elMesh, e_i );
 		Mesh_ElementType_GetCentroid( elType, e_i, centroid );
 		vert = Mesh_GetVertex( mesh, e_i );
 		memcpy( vert, centroid, nDims * sizeof(double) );
 	}
 	FreeArray( centroid );
+	mesh->parentMeshVersion = elMesh->geometryVersion;
 }
 
 void C0Generator_BuildElementTypes( C0Generator* self, FeMesh* mesh ) {
@@ -53,6 +53,14 @@ void _ElementType_Init( ElementType* self, Index nodeCount ) {
 	/* Using 3 here instead of dim so that you can pass in dim = 2 and use axes 0 and 2 for your jacobian */
 	self->_jacobian = Memory_Alloc_2DArray( double, 3, 3, (Name)"Temporary Jacobian"  );
 
+	self->cacheJacobians = True;
+	self->jacCacheMesh = NULL;
+	self->jacCacheBuilt = False;
+	self->jacCacheVersion = 0;
+	self->jacCacheSize = 0;
+	self->jacCacheUniform = False;
+	self->jacCacheAffine = NULL;
+	self->jacCache = NULL;
 }
 
 
@@ -60,6 +68,10 @@ void _ElementType_Destroy( void* elementType, void* data ){
 	ElementType* self = (ElementType*)elementType;
 
 	Memory_Free(self->_jacobian); self->_jacobian = NULL;
+	FreeArray( self->jacCacheAffine ); self->jacCacheAffine = NULL;
+	FreeArray( self->jacCache ); self->jacCache = NULL;
+	self->jacCacheSize = 0;
+	self->jacCacheBuilt = False;
 	
 	Stg_Class_Delete( self->inc );
 }
@@ -172,6 +184,102 @@ void ElementType_ConvertGlobalCoordToElLocal(
 }
 
 
+/* +++ Private Functions +++ */
+
+void _ElementType_BuildJacobian( ElementType* self, Mesh* mesh, int* inc, int dim, double** GNi, double jac[3][3] ) {
+	double*	nodeCoord;
+	Index	nodesPerEl = self->nodeCount;
+	int	n;
+
+	/* build the jacobian matrix */
+	/*
+	jac = 	\sum_i d/d\xi( N_i ) x_i 		\sum_i d/d\xi( N_i ) y_i
+			\sum_i d/d\eta( N_i ) x_i 		\sum_i d/d\eta( N_i ) y_i
+	*/
+	/* unroll this bugger cause we do it all the time */
+	if( dim == 2 ) {
+		jac[0][0] = jac[0][1] = jac[1][0] = jac[1][1] = 0.0;
+		for( n=0; n<nodesPerEl; n++){	
+			nodeCoord = Mesh_GetVertex( mesh, inc[n] );
+			jac[0][0] = jac[0][0] + GNi[0][n] * nodeCoord[0];
+			jac[0][1] = jac[0][1] + GNi[0][n] * nodeCoord[1];
+			
+			jac[1][0] = jac[1][0] + GNi[1][n] * nodeCoord[0];
+			jac[1][1] = jac[1][1] + GNi[1][n] * nodeCoord[1];
+		}
+	}
+	
+	if( dim == 3 ) {
+		jac[0][0] = jac[0][1] = jac[0][2] = 0.0;
+		jac[1][0] = jac[1][1] = jac[1][2] = 0.0;
+		jac[2][0] = jac[2][1] = jac[2][2] = 0.0;
+		for( n=0; n<nodesPerEl; n++){	
+			nodeCoord = Mesh_GetVertex( mesh, inc[n] );
+			jac[0][0] = jac[0][0] + GNi[0][n] * nodeCoord[0];
+			jac[0][1] = jac[0][1] + GNi[0][n] * nodeCoord[1];
+			jac[0][2] = jac[0][2] + GNi[0][n] * nodeCoord[2];
+			
+			jac[1][0] = jac[1][0] + GNi[1][n] * nodeCoord[0];
+			jac[1][1] = jac[1][1] + GNi[1][n] * nodeCoord[1];
+			jac[1][2] = jac[1][2] + GNi[1][n] * nodeCoord[2];
+			
+			jac[2][0] = jac[2][0] + GNi[2][n] * nodeCoord[0];
+			jac[2][1] = jac[2][1] + GNi[2][n] * nodeCoord[1];
+			jac[2][2] = jac[2][2] + GNi[2][n] * nodeCoord[2];
+		}
+	}
+}
+
+double _ElementType_InvertJacobian( int dim, double jac[3][3], double inv[3][3] ) {
+	double D = 0.0;
+	int i, j;
+
+	/* get determinant of the jacobian matrix */
+	if( dim == 2 ) {
+		D = jac[0][0]*jac[1][1] - jac[0][1]*jac[1][0]; 
+	}		
+	if( dim == 3 ) {
+		D = jac[0][0]*( jac[1][1]*jac[2][2] - jac[1][2]*jac[2][1] ) 
+				  - jac[0][1]*( jac[1][0]*jac[2][2] - jac[1][2]*jac[2][0] ) 
+				  + jac[0][2]*( jac[1][0]*jac[2][1] - jac[1][1]*jac[2][0] );
+	}
+	
+	/* invert the jacobian matrix A^-1 = adj(A)/det(A) */
+	if( dim == 2 ) {
+		inv[0][0] = jac[1][1]/D;
+		inv[1][1] = jac[0][0]/D;
+		inv[0][1] = -jac[0][1]/D;
+		inv[1][0] = -jac[1][0]/D;		
+	}
+	if( dim == 3 ) {
+		/*
+		00 01 02
+		10 11 12
+		20 21 22		
+		*/		
+		inv[0][0] = jac[1][1]*jac[2][2] - jac[1][2]*jac[2][1];
+		inv[1][0] = -(jac[1][0]*jac[2][2] - jac[1][2]*jac[2][0]);
+		inv[2][0] = jac[1][0]*jac[2][1] - jac[1][1]*jac[2][0];
+		
+		inv[0][1] = -(jac[0][1]*jac[2][2] - jac[0][2]*jac[2][1]);
+		inv[1][1] = jac[0][0]*jac[2][2] - jac[0][2]*jac[2][0];
+		inv[2][1] = -(jac[0][0]*jac[2][1] - jac[0][1]*jac[2][0]);
+		
+		inv[0][2] = jac[0][1]*jac[1][2] - jac[0][2]*jac[1][1];
+		inv[1][2] = -(jac[0][0]*jac[1][2] - jac[0][2]*jac[1][0]);
+		inv[2][2] = jac[0][0]*jac[1][1] - jac[0][1]*jac[1][0];
+		
+		for( i=0; i<dim; i++ ) {
+			for( j=0; j<dim; j++ ) {
+				inv[i][j] = inv[i][j]/D;
+			}
+		}
+	}
+
+	return D;
+}
+
+
 /* +++ Virtual Function Implementations +++ */
 
 void _ElementType_ConvertGlobalCoordToElLocal(
@@ -198,6 +306,8 @@ void _ElementType_ConvertGlobalCoordToElLocal(
 	double**            GNi = self->GNi;
 	unsigned	    nInc;
 	int             *inc;
+	double*             cached;
+	double              (*jacInv)[3];
 	Dimension_Index     dim             = Mesh_GetDimSize( mesh );
 
 	/* This function uses a Newton-Raphson iterative method to find the local coordinate from the global coordinate 
@@ -224,6 +334,9 @@ void _ElementType_ConvertGlobalCoordToElLocal(
 	 *
 	 * */
 
+	/* Look up the cached Jacobian first, as rebuilding the cache reuses self->inc for every element. */
+	cached = ElementType_GetCachedJacobian( self, mesh, element, dim );
+
 	Mesh_GetIncidence( mesh, Mesh_GetDimSize( mesh ), element, MT_VERTEX, self->inc );
 	nInc = IArray_GetSize( self->inc );
 	inc = IArray_GetPtr( self->inc );
@@ -231,6 +344,29 @@ void _ElementType_ConvertGlobalCoordToElLocal(
 	/* Initial guess for element local coordinate is in the centre of the element - ( 0.0, 0.0, 0.0 ) */
 	memset( elLocalCoord, 0, dim*sizeof(double) );
 
+	/* If the element is affine the map is linear, so invert it directly about the centre using the
+	   cached inverse Jacobian rather than iterating. */
+	if( cached ) {
+		jacInv = (double (*)[3])(cached + 1);
+		ElementType_EvaluateShapeFunctionsAt( self, elLocalCoord, evaluatedShapeFuncs );
+		memcpy( rightHandSide, globalCoord, dim*sizeof(double) );
+		for ( node_I = 0 ; node_I < nodeCount ; node_I++ ) {
+			shapeFunc = evaluatedShapeFuncs[node_I];
+			nodeCoord = Mesh_GetVertex( mesh, inc[node_I] );
+			rightHandSide[ I_AXIS ] -= shapeFunc * nodeCoord[ I_AXIS ];
+			rightHandSide[ J_AXIS ] -= shapeFunc * nodeCoord[ J_AXIS ];
+			if ( dim == 3 )
+				rightHandSide[ K_AXIS ] -= shapeFunc * nodeCoord[ K_AXIS ];
+		}
+		for ( iteration_I = 0 ; iteration_I < dim ; iteration_I++ ) {
+			elLocalCoord[ iteration_I ] = jacInv[ I_AXIS ][ iteration_I ] * rightHandSide[ I_AXIS ]
+			                            + jacInv[ J_AXIS ][ iteration_I ] * rightHandSide[ J_AXIS ];
+			if ( dim == 3 )
+				elLocalCoord[ iteration_I ] += jacInv[ K_AXIS ][ iteration_I ] * rightHandSide[ K_AXIS ];
+		}
+		return;
+	}
+
 	/* Do Newton-Raphson Iteration */
 	for ( iteration_I = 0 ; iteration_I < maxIterations ; iteration_I++ ) {
 		/* Initialise Values */
@@ -313,32 +449,22 @@ void ElementType_ShapeFunctionsGlobalDerivs(
 {
 	ElementType*			self = (ElementType*)elementType;
 	Mesh*				mesh = (Mesh*)_mesh;
-	double				*nodeCoord;
 	
 	double jac[3][3];
-	int rows;		/* max dimensions */
-	int cols;		/* max nodes per el */
+	double inv[3][3];
+	double (*jacInv)[3];
+	double* cached;
 	double** GNi; 
-	int n, i, j;
+	int n;
 	double globalSF_DerivVal;
 	int dx, dxi;
-	double tmp, D = 0.0;
-	double cof[3][3];	/* cofactors */
-	unsigned nInc;
-	int      *inc;
+	double D = 0.0;
 	Index nodesPerEl;
 
-	rows=Mesh_GetDimSize( mesh );
-	cols=self->nodeCount;	
-	
 	GNi = self->GNi;
 
 	nodesPerEl = self->nodeCount;
 
-	Mesh_GetIncidence( mesh, Mesh_GetDimSize( mesh ), elId, MT_VERTEX, self->inc );
-	nInc = IArray_GetSize( self->inc );
-	inc = IArray_GetPtr( self->inc );
-	
 	/*
 	If constant shape function gets passed in here, getLocalDeriv will
 	indicate the error and exit code.
@@ -346,99 +472,27 @@ void ElementType_ShapeFunctionsGlobalDerivs(
 	
 	self->_evaluateShapeFunctionLocalDerivsAt( self, xi, GNi );
 	
-	
-	/* build the jacobian matrix */
-	/*
-	jac = 	\sum_i d/d\xi( N_i ) x_i 		\sum_i d/d\xi( N_i ) y_i
-			\sum_i d/d\eta( N_i ) x_i 		\sum_i d/d\eta( N_i ) y_i
-	*/
-	/* unroll this bugger cause we do it all the time */
-	if( dim == 2 ) {
-		jac[0][0] = jac[0][1] = jac[1][0] = jac[1][1] = 0.0;
-		for( n=0; n<nodesPerEl; n++){	
-			nodeCoord = Mesh_GetVertex( mesh, inc[n] );
-			jac[0][0] = jac[0][0] + GNi[0][n] * nodeCoord[0];
-			jac[0][1] = jac[0][1] + GNi[0][n] * nodeCoord[1];
-			
-			jac[1][0] = jac[1][0] + GNi[1][n] * nodeCoord[0];
-			jac[1][1] = jac[1][1] + GNi[1][n] * nodeCoord[1];
-		}
-	}
-	
-	if( dim == 3 ) {
-		jac[0][0] = jac[0][1] = jac[0][2] = 0.0;
-		jac[1][0] = jac[1][1] = jac[1][2] = 0.0;
-		jac[2][0] = jac[2][1] = jac[2][2] = 0.0;
-		for( n=0; n<nodesPerEl; n++){	
-			nodeCoord = Mesh_GetVertex( mesh, inc[n] );
-			jac[0][0] = jac[0][0] + GNi[0][n] * nodeCoord[0];
-			jac[0][1] = jac[0][1] + GNi[0][n] * nodeCoord[1];
-			jac[0][2] = jac[0][2] + GNi[0][n] * nodeCoord[2];
-			
-			jac[1][0] = jac[1][0] + GNi[1][n] * nodeCoord[0];
-			jac[1][1] = jac[1][1] + GNi[1][n] * nodeCoord[1];
-			jac[1][2] = jac[1][2] + GNi[1][n] * nodeCoord[2];
-			
-			jac[2][0] = jac[2][0] + GNi[2][n] * nodeCoord[0];
-			jac[2][1] = jac[2][1] + GNi[2][n] * nodeCoord[1];
-			jac[2][2] = jac[2][2] + GNi[2][n] * nodeCoord[2];
-		}
+	/* Affine elements have a constant Jacobian, so use the cached one if we have it. */
+	cached = ElementType_GetCachedJacobian( self, mesh, elId, dim );
+	if( cached ) {
+		D = cached[0];
+		jacInv = (double (*)[3])(cached + 1);
 	}
-	
-	/* get determinant of the jacobian matrix */
-	if( dim == 2 ) {
-		D = jac[0][0]*jac[1][1] - jac[0][1]*jac[1][0]; 
-	}		
-	if( dim == 3 ) {
-		D = jac[0][0]*( jac[1][1]*jac[2][2] - jac[1][2]*jac[2][1] ) 
-				  - jac[0][1]*( jac[1][0]*jac[2][2] - jac[1][2]*jac[2][0] ) 
-				  + jac[0][2]*( jac[1][0]*jac[2][1] - jac[1][1]*jac[2][0] );
+	else {
+		Mesh_GetIncidence( mesh, Mesh_GetDimSize( mesh ), elId, MT_VERTEX, self->inc );
+		_ElementType_BuildJacobian( self, mesh, IArray_GetPtr( self->inc ), dim, GNi, jac );
+		D = _ElementType_InvertJacobian( dim, jac, inv );
+		jacInv = inv;
 	}
 	(*detJac) = D;
 	
-	
-	/* invert the jacobian matrix A^-1 = adj(A)/det(A) */
-	if( dim == 2 ) {
-		tmp = jac[0][0];
-		jac[0][0] = jac[1][1]/D;
-		jac[1][1] = tmp/D;
-		jac[0][1] = -jac[0][1]/D;
-		jac[1][0] = -jac[1][0]/D;		
-	}
-	if( dim == 3 ) {
-		/*
-		00 01 02
-		10 11 12
-		20 21 22		
-		*/		
-		cof[0][0] = jac[1][1]*jac[2][2] - jac[1][2]*jac[2][1];
-		cof[1][0] = -(jac[1][0]*jac[2][2] - jac[1][2]*jac[2][0]);
-		cof[2][0] = jac[1][0]*jac[2][1] - jac[1][1]*jac[2][0];
-		
-		cof[0][1] = -(jac[0][1]*jac[2][2] - jac[0][2]*jac[2][1]);
-		cof[1][1] = jac[0][0]*jac[2][2] - jac[0][2]*jac[2][0];
-		cof[2][1] = -(jac[0][0]*jac[2][1] - jac[0][1]*jac[2][0]);
-		
-		cof[0][2] = jac[0][1]*jac[1][2] - jac[0][2]*jac[1][1];
-		cof[1][2] = -(jac[0][0]*jac[1][2] - jac[0][2]*jac[1][0]);
-		cof[2][2] = jac[0][0]*jac[1][1] - jac[0][1]*jac[1][0];
-		
-		for( i=0; i<dim; i++ ) {
-			for( j=0; j<dim; j++ ) {
-				jac[i][j] = cof[i][j]/D;
-			}
-		}
-		
-		
-	}
-	
 	/* get global derivs Ni_x, Ni_y and Ni_z if dim == 3 */
 	for( dx=0; dx<dim; dx++ ) {
 		for( n=0; n<nodesPerEl; n++ ) {
 			
 			globalSF_DerivVal = 0.0;
 			for(dxi=0; dxi<dim; dxi++) {
-				globalSF_DerivVal = globalSF_DerivVal + GNi[dxi][n] * jac[dx][dxi];
+				globalSF_DerivVal = globalSF_DerivVal + GNi[dxi][n] * jacInv[dx][dxi];
 			}
 			
 			GNx[dx][n] = globalSF_DerivVal;
@@ -446,6 +500,161 @@ void ElementType_ShapeFunctionsGlobalDerivs(
 	}
 }
 
+void ElementType_SetJacobianCaching( void* elementType, void* mesh, Bool cache ) {
+	ElementType*	self = (ElementType*)elementType;
+
+	assert( self );
+
+	self->jacCacheMesh = (Mesh*)mesh;
+	self->cacheJacobians = cache;
+
+	/* Drop anything we have, it will be rebuilt on demand. */
+	FreeArray( self->jacCacheAffine ); self->jacCacheAffine = NULL;
+	FreeArray( self->jacCache ); self->jacCache = NULL;
+	self->jacCacheSize = 0;
+	self->jacCacheUniform = False;
+	self->jacCacheBuilt = False;
+}
+
+void ElementType_UpdateJacobianCache( void* elementType ) {
+	ElementType*	self = (ElementType*)elementType;
+	Mesh*		mesh = self->jacCacheMesh;
+	const double	tol = 1e-10;
+	unsigned	nDims, nEls, nSamples, centre, nAffine;
+	unsigned	e_i, s_i, ii, jj;
+	double***	sampleGNi;
+	double		xi[3], jac0[3][3], jac[3][3], inv[3][3];
+	double		scale, invScale, *entry, *first;
+	Bool		affine, uniform;
+	int*		inc;
+
+	assert( self );
+
+	FreeArray( self->jacCacheAffine ); self->jacCacheAffine = NULL;
+	FreeArray( self->jacCache ); self->jacCache = NULL;
+	self->jacCacheSize = 0;
+	self->jacCacheUniform = False;
+	self->jacCacheBuilt = True;
+
+	if( !mesh )
+		return;
+	self->jacCacheVersion = mesh->geometryVersion;
+
+	nDims = Mesh_GetDimSize( mesh );
+	if( !self->cacheJacobians || !mesh->isRegular || nDims < 2 || nDims > 3 )
+		return;
+	nEls = Mesh_GetDomainSize( mesh, nDims );
+	if( !nEls )
+		return;
+
+	/* Evaluate the local derivatives at the points with local coordinates in {-1, 0, 1}. Each
+	   Jacobian entry is at most quadratic in each local coordinate for the element types we have,
+	   so it is constant over the element iff it takes the same value at all of these points. */
+	nSamples = (nDims == 2) ? 9 : 27;
+	centre = nSamples / 2;
+	sampleGNi = AllocArray( double**, nSamples );
+	for( s_i = 0; s_i < nSamples; s_i++ ) {
+		xi[0] = (double)(s_i % 3) - 1.0;
+		xi[1] = (double)((s_i / 3) % 3) - 1.0;
+		xi[2] = (double)(s_i / 9) - 1.0;
+		sampleGNi[s_i] = AllocArray2D( double, 3, self->nodeCount );
+		self->_evaluateShapeFunctionLocalDerivsAt( self, xi, sampleGNi[s_i] );
+	}
+
+	self->jacCache = AllocArray( double, nEls * ELEMENTTYPE_JACCACHE_STRIDE );
+	self->jacCacheAffine = AllocArray( Bool, nEls );
+	first = self->jacCache;
+	nAffine = 0;
+	uniform = True;
+
+	for( e_i = 0; e_i < nEls; e_i++ ) {
+		self->jacCacheAffine[e_i] = False;
+		Mesh_GetIncidence( mesh, nDims, e_i, MT_VERTEX, self->inc );
+		if( IArray_GetSize( self->inc ) != self->nodeCount ) {
+			uniform = False;
+			continue;
+		}
+		inc = IArray_GetPtr( self->inc );
+
+		_ElementType_BuildJacobian( self, mesh, inc, nDims, sampleGNi[centre], jac0 );
+		scale = 0.0;
+		for( ii = 0; ii < nDims; ii++ ) {
+			for( jj = 0; jj < nDims; jj++ )
+				scale = (fabs( jac0[ii][jj] ) > scale) ? fabs( jac0[ii][jj] ) : scale;
+		}
+
+		affine = True;
+		for( s_i = 0; s_i < nSamples && affine; s_i++ ) {
+			if( s_i == centre )
+				continue;
+			_ElementType_BuildJacobian( self, mesh, inc, nDims, sampleGNi[s_i], jac );
+			for( ii = 0; ii < nDims && affine; ii++ ) {
+				for( jj = 0; jj < nDims; jj++ ) {
+					if( fabs( jac[ii][jj] - jac0[ii][jj] ) > tol * scale ) {
+						affine = False;
+						break;
+					}
+				}
+			}
+		}
+		if( !affine ) {
+			uniform = False;
+			continue;
+		}
+
+		memset( inv, 0, sizeof(inv) );
+		entry = self->jacCache + e_i * ELEMENTTYPE_JACCACHE_STRIDE;
+		entry[0] = _ElementType_InvertJacobian( nDims, jac0, inv );
+		memcpy( entry + 1, inv, 9 * sizeof(double) );
+		self->jacCacheAffine[e_i] = True;
+		nAffine++;
+
+		/* Are all the elements the same so far? */
+		if( uniform && e_i > 0 ) {
+			if( fabs( entry[0] - first[0] ) > tol * fabs( first[0] ) )
+				uniform = False;
+			invScale = 0.0;
+			for( ii = 1; ii < ELEMENTTYPE_JACCACHE_STRIDE; ii++ )
+				invScale = (fabs( first[ii] ) > invScale) ? fabs( first[ii] ) : invScale;
+			for( ii = 1; ii < ELEMENTTYPE_JACCACHE_STRIDE && uniform; ii++ ) {
+				if( fabs( entry[ii] - first[ii] ) > tol * invScale )
+					uniform = False;
+			}
+		}
+	}
+
+	FreeArray2D( nSamples, sampleGNi );
+
+	if( !nAffine ) {
+		FreeArray( self->jacCacheAffine ); self->jacCacheAffine = NULL;
+		FreeArray( self->jacCache ); self->jacCache = NULL;
+		return;
+	}
+	if( uniform ) {
+		/* Only need to keep the one. */
+		self->jacCache = ReallocArray( self->jacCache, double, ELEMENTTYPE_JACCACHE_STRIDE );
+		FreeArray( self->jacCacheAffine ); self->jacCacheAffine = NULL;
+		self->jacCacheUniform = True;
+	}
+	self->jacCacheSize = nEls;
+}
+
+double* ElementType_GetCachedJacobian( void* elementType, void* _mesh, Element_DomainIndex elId, int dim ) {
+	ElementType*	self = (ElementType*)elementType;
+	Mesh*		mesh = (Mesh*)_mesh;
+
+	if( !self->cacheJacobians || mesh != self->jacCacheMesh || !mesh->isRegular )
+		return NULL;
+	if( !self->jacCacheBuilt || self->jacCacheVersion != mesh->geometryVersion )
+		ElementType_UpdateJacobianCache( self );
+	if( elId >= self->jacCacheSize || dim != Mesh_GetDimSize( mesh ) )
+		return NULL;
+
+	if( self->jacCacheUniform )
+		return self->jacCache;
+	return self->jacCacheAffine[elId] ? self->jacCache + elId * ELEMENTTYPE_JACCACHE_STRIDE : NULL;
+}
+
 void ElementType_Jacobian_AxisIndependent( 
 		void*               elementType, 
 		void*               _mesh, 
@@ -54,10 +54,22 @@
 		/* below are temporary storage data structures */ \
 		double     **GNi; \
 		double     *evaluatedShapeFunc; \
-        double     **_jacobian;
+        double     **_jacobian; \
+		/* cached Jacobian determinant and inverse for affine elements of jacCacheMesh */ \
+		Bool                                cacheJacobians; \
+		Mesh*                               jacCacheMesh; \
+		Bool                                jacCacheBuilt; \
+		unsigned                            jacCacheVersion; \
+		unsigned                            jacCacheSize; \
+		Bool                                jacCacheUniform; \
+		Bool*                               jacCacheAffine; \
+		double*                             jacCache;
 
 	struct ElementType { __ElementType };
 
+	/* Each Jacobian cache entry holds the determinant followed by the 3x3 inverse */
+	#define ELEMENTTYPE_JACCACHE_STRIDE 10
+
 
 
 	
@@ -140,6 +152,19 @@
 		double*			detJac, 
 		double**		GNx );
 
+	/** Enables or disables caching of the Jacobian for affine elements of the given mesh. Only regular
+	meshes are cached. The cache is rebuilt lazily whenever Mesh_DeformationUpdate() has moved vertices of the
+	mesh since it was last built. */
+	void ElementType_SetJacobianCaching( void* elementType, void* mesh, Bool cache );
+
+	/** (Re)builds the Jacobian cache. Elements whose Jacobian is constant (ie. affine elements) have their
+	Jacobian determinant and inverse stored, and if all elements share the same Jacobian only a single entry is
+	kept. */
+	void ElementType_UpdateJacobianCache( void* elementType );
+
+	/** Returns the cached Jacobian entry for the element, or NULL if there is none. */
+	double* ElementType_GetCachedJacobian( void* elementType, void* mesh, Element_DomainIndex elId, int dim );
+
 	int _ElementType_SurfaceNormal(
 		void*			elementType,
 		unsigned		lElement_I,
@@ -198,5 +223,9 @@
 	void ElementType_GetFaceNodes( void* elementType, Mesh* mesh, 
 					unsigned element_I, unsigned face_I, unsigned nNodes, unsigned* nodes );
 
+	/* Private functions */
+	void _ElementType_BuildJacobian( ElementType* self, Mesh* mesh, int* inc, int dim, double** GNi, double jac[3][3] );
+	double _ElementType_InvertJacobian( int dim, double jac[3][3], double inv[3][3] );
+
 #endif /* __StgFEM_Discretisation_ElementType_h__ */
 
@@ -152,6 +152,9 @@ void _FeEquationNumber_Init(
    self->globalSumUnconstrainedDofs = 0;
    self->isBuilt = False;
    self->locationMatrixBuilt = False;
+   self->locationMatrix = NULL;
+   self->locationMatrixRows = NULL;
+   self->locationMatrixEqNums = NULL;
    self->_lowestLocalEqNum = -1;
    self->_lowestGlobalEqNums = NULL;
    self->_highestLocalEqNum = -1;
@@ -183,7 +186,6 @@ void _FeEquationNumber_Execute( void* feEquationNumber, void *data ){
 
 void _FeEquationNumber_Destroy( void* feEquationNumber, void *data ){
    FeEquationNumber* self = (FeEquationNumber*) feEquationNumber;
-   Index ii;
 
    /* free destination array memory */
    Journal_DPrintfL( self->debug, 2, "Freeing I.D. Array\n" );
@@ -191,9 +193,8 @@ void _FeEquationNumber_Destroy( void* feEquationNumber, void *data ){
 
    if (self->locationMatrix) {
       Journal_DPrintfL( self->debug, 2, "Freeing Full L.M. Array\n" );
-      for( ii = 0; ii < self->nDomainEls; ii++ )
-         FreeArray( self->locationMatrix[ii] );
-
+      FreeArray( self->locationMatrixEqNums );
+      FreeArray( self->locationMatrixRows );
       FreeArray( self->locationMatrix );
    }
 
@@ -263,8 +264,20 @@ void _FeEquationNumber_Build( void* feEquationNumber, void* data ) {
 	/* If we have new mesh topology information, do this differently. */
    /* if( self->feMesh->topo->domains && self->feMesh->topo->domains[MT_VERTEX] ) { */
 
-   if( Mesh_HasExtension( self->feMesh, "vertexGrid" ) )
-      FeEquationNumber_BuildWithDave( self );
+   if( Mesh_HasExtension( self->feMesh, "vertexGrid" ) ) {
+      int* periodic = Mesh_GetExtension( self->feMesh, int*, self->feMesh->periodicId );
+      Bool isPeriodic = False;
+      int dim_i;
+
+      for( dim_i = 0; dim_i < Mesh_GetDimSize( self->feMesh ); dim_i++ )
+         isPeriodic = isPeriodic || periodic[dim_i] || self->periodic[dim_i];
+
+      /* Periodic meshes need their opposing boundaries merged, which Dave's routine does. */
+      if( isPeriodic )
+         FeEquationNumber_BuildWithDave( self );
+      else
+         FeEquationNumber_BuildRegular( self );
+   }
    else
       FeEquationNumber_BuildWithTopology( self );
 
@@ -341,15 +354,19 @@ void FeEquationNumber_BuildLocationMatrix( void* feEquationNumber ) {
    int*       elNodes;
    int**			dstArray;
    int***			locMat;
+   int**			rows;
+   int*			eqNums;
+   int**			curRow;
+   int*			curEqNum;
+   unsigned		nRows, nEqNums;
    IArray*			inc;
-   unsigned		e_i, n_i, dof_i;
+   unsigned		e_i, n_i;
 
    assert( self );
 
    /* Don't build if already done. */
    if( self->locationMatrixBuilt ) {
       Journal_DPrintf( self->debugLM, "In %s: LM already built, so just returning.\n",  __func__ );
-      Stream_UnIndentBranch( StgFEM_Debug );
       return;
    }
 
@@ -361,32 +378,47 @@ void FeEquationNumber_BuildLocationMatrix( void* feEquationNumber ) {
    nNodalDofs = self->dofLayout->dofCounts;
    dstArray = self->mapNodeDof2Eq;
 
-   /* Allocate for the location matrix. */
-   locMat = AllocArray( int**, nDomainEls );
+   /* Size the location matrix. */
+   nRows = 0;
+   nEqNums = 0;
    for( e_i = 0; e_i < nDomainEls; e_i++ ) {
       FeMesh_GetElementNodes( feMesh, e_i, inc );
       nElNodes = IArray_GetSize( inc );
       elNodes = IArray_GetPtr( inc );
-      locMat[e_i] = AllocArray( int*, nElNodes );
+      nRows += nElNodes;
       for( n_i = 0; n_i < nElNodes; n_i++ )
-         locMat[e_i][n_i] = AllocArray( int, nNodalDofs[elNodes[n_i]] );
+         nEqNums += nNodalDofs[elNodes[n_i]];
    }
 
+   /* Allocate it as one flat array of eq nums, with the element and element node tables
+      pointing into it. */
+   locMat = AllocArray( int**, nDomainEls );
+   rows = AllocArray( int*, nRows );
+   eqNums = AllocArray( int, nEqNums );
+
    /* Build location matrix. */
+   curRow = rows;
+   curEqNum = eqNums;
    for( e_i = 0; e_i < nDomainEls; e_i++ ) {
       FeMesh_GetElementNodes( feMesh, e_i, inc );
       nElNodes = IArray_GetSize( inc );
       elNodes = IArray_GetPtr( inc );
+      locMat[e_i] = curRow;
       for( n_i = 0; n_i < nElNodes; n_i++ ) {
-         for( dof_i = 0; dof_i < nNodalDofs[elNodes[n_i]]; dof_i++ )
-            locMat[e_i][n_i][dof_i] = dstArray[elNodes[n_i]][dof_i];
+         *curRow++ = curEqNum;
+         memcpy( curEqNum, dstArray[elNodes[n_i]], nNodalDofs[elNodes[n_i]] * sizeof(int) );
+         curEqNum += nNodalDofs[elNodes[n_i]];
       }
    }
 
    Stg_Class_Delete( inc );
 
    /* Store result. */
+   self->nDomainEls = nDomainEls;
    self->locationMatrix = locMat;
+   self->locationMatrixRows = rows;
+   self->locationMatrixEqNums = eqNums;
+   self->locationMatrixBuilt = True;
 }
 
 FeEquationNumber* _FeEquationNumber_Create( void* _self, Bool removeBCs ) {
@@ -582,26 +614,21 @@ void FeEquationNumber_BuildWithTopology( FeEquationNumber* self ) {
    unsigned		nDomainNodes;
    unsigned		nLocalNodes;
    unsigned*		nNodalDofs;
-   unsigned		nElNodes, *elNodes;
    int**		dstArray;
-   int			*nLocMatDofs, ***locMat;
    unsigned		varInd;
    unsigned		curEqNum;
    unsigned		base;
    unsigned		subTotal;
-   MPI_Status		status;
+   int*			counts;
    unsigned		maxDofs;
    unsigned*		tuples;
    LinkedDofInfo*	links;
    unsigned		highest;
-   IArray*		inc;
-   unsigned             e_i, n_i, dof_i, s_i;
+   unsigned             n_i, dof_i, s_i;
    int			ii;
 
    assert( self );
 
-   inc = IArray_New();
-
 //   stream = Journal_Register( Info_Type, (Name)self->type  );
 //   Stream_SetPrintingRank( stream, 0 );
 //
@@ -642,20 +669,6 @@ void FeEquationNumber_BuildWithTopology( FeEquationNumber* self ) {
          links->eqNumsOfLinkedDofs[s_i] = -1;
    }
 
-   /* Allocate for the location matrix. */
-   nLocMatDofs = NULL;
-   locMat = AllocArray( int**, self->nDomainEls );
-   for( e_i = 0; e_i < self->nDomainEls; e_i++ ) {
-      FeMesh_GetElementNodes( feMesh, e_i, inc );
-      nElNodes = IArray_GetSize( inc );
-      elNodes = IArray_GetPtr( inc );
-      nLocMatDofs = ReallocArray( nLocMatDofs, int, nElNodes );
-      for( n_i = 0; n_i < nElNodes; n_i++ )
-         nLocMatDofs[n_i] = nNodalDofs[elNodes[n_i]];
-      locMat[e_i] = AllocComplex2D( int, nElNodes, nLocMatDofs );
-   }
-   FreeArray( nLocMatDofs );
-
    /* Build initial destination array and store max dofs. */
    curEqNum = 0;
    maxDofs = 0;
@@ -685,28 +698,29 @@ void FeEquationNumber_BuildWithTopology( FeEquationNumber* self ) {
       }
    }
 
-   /* Order the equation numbers based on processor rank; cascade counts forward. */
-   base = 0;
-   if( rank > 0 )
-      (void)MPI_Recv( &base, 1, MPI_UNSIGNED, rank - 1, 6669, mpiComm, &status );
+   /* Order the equation numbers based on processor rank; a prefix sum of the gathered counts
+      gives each rank's base, the lowest eq num of every rank and the global total at once. */
+   counts = AllocArray( int, nProcs );
+   (void)MPI_Allgather( &curEqNum, 1, MPI_UNSIGNED, counts, 1, MPI_UNSIGNED, mpiComm );
+   self->_lowestGlobalEqNums = AllocArray( int, nProcs );
+   subTotal = 0;
+   for( ii = 0; ii < nProcs; ii++ ) {
+      self->_lowestGlobalEqNums[ii] = subTotal;
+      subTotal += counts[ii];
+   }
+   FreeArray( counts );
+   self->globalSumUnconstrainedDofs = subTotal;
+   base = self->_lowestGlobalEqNums[rank];
    subTotal = base + curEqNum;
-   if( rank < nProcs - 1 )
-      (void)MPI_Send( &subTotal, 1, MPI_UNSIGNED, rank + 1, 6669, mpiComm );
 
-   if( links ) {
-      /* Reduce to find lowest linked DOFs. */
+   if( links && links->linkedDofSetsCount ) {
+      /* Linked DOFs are only numbered on the first rank; reduce them all at once to share them. */
       for( s_i = 0; s_i < links->linkedDofSetsCount; s_i++ ) {
          if( links->eqNumsOfLinkedDofs[s_i] != -1 )
             links->eqNumsOfLinkedDofs[s_i] += base;
-/*
-  MPI_Allreduce( links->eqNumsOfLinkedDofs + s_i, &lowest, 1, MPI_UNSIGNED, MPI_MAX, mpiComm );
-*/
-         MPI_Allreduce( links->eqNumsOfLinkedDofs + s_i, &highest, 1, MPI_INT, MPI_MAX, mpiComm );
-/*
-  assert( (lowest == (unsigned)-1) ? lowest == highest : 1 );
-*/
-         links->eqNumsOfLinkedDofs[s_i] = highest;
       }
+      (void)MPI_Allreduce( MPI_IN_PLACE, links->eqNumsOfLinkedDofs, links->linkedDofSetsCount,
+                           MPI_INT, MPI_MAX, mpiComm );
    }
 
    /* Modify existing destination array and dump to a tuple array. */
@@ -751,21 +765,9 @@ void FeEquationNumber_BuildWithTopology( FeEquationNumber* self ) {
    /* Destroy tuple array. */
    FreeArray( tuples );
 
-   /* Build location matrix. */
-   for( e_i = 0; e_i < self->nDomainEls; e_i++ ) {
-      FeMesh_GetElementNodes( feMesh, e_i, inc );
-      nElNodes = IArray_GetSize( inc );
-      elNodes = IArray_GetPtr( inc );
-      for( n_i = 0; n_i < nElNodes; n_i++ ) {
-         for( dof_i = 0; dof_i < nNodalDofs[elNodes[n_i]]; dof_i++ )
-            locMat[e_i][n_i][dof_i] = dstArray[elNodes[n_i]][dof_i];
-      }
-   }
-
    /* Store stuff on class. */
    self->mapNodeDof2Eq = dstArray;
-   self->locationMatrix = locMat;
-   self->locationMatrixBuilt = True;
+   FeEquationNumber_BuildLocationMatrix( self );
    self->remappingActivated = False;
    self->localEqNumsOwnedCount = curEqNum;
    self->firstOwnedEqNum = base;
@@ -779,15 +781,6 @@ void FeEquationNumber_BuildWithTopology( FeEquationNumber* self ) {
       STreeMap_Insert( self->ownedMap, &ii, &val );
    }
 
-   /* Bcast global sum from highest rank. */
-   if( rank == nProcs - 1 )
-      self->globalSumUnconstrainedDofs = self->lastOwnedEqNum + 1;
-   (void)MPI_Bcast( &self->globalSumUnconstrainedDofs, 1, MPI_UNSIGNED, nProcs - 1, mpiComm );
-
-   /* Construct lowest global equation number list. */
-   self->_lowestGlobalEqNums = AllocArray( int, nProcs );
-   (void)MPI_Allgather( &self->firstOwnedEqNum, 1, MPI_UNSIGNED, self->_lowestGlobalEqNums, 1, MPI_UNSIGNED, mpiComm );
-
 //   endTime = MPI_Wtime();
 
 //   Journal_RPrintf( stream, "Assigned %d global equation numbers.\n", self->globalSumUnconstrainedDofs );
@@ -800,8 +793,93 @@ void FeEquationNumber_BuildWithTopology( FeEquationNumber* self ) {
 //   (void)MPI_Reduce( &time, &tmax, 1, MPI_DOUBLE, MPI_MAX, 0, mpiComm );
 //   Journal_RPrintf( stream, "... Completed in %g [min] / %g [max] seconds.\n", tmin, tmax );
 //   Stream_UnIndent( stream );
+}
 
-   Stg_Class_Delete( inc );
+void FeEquationNumber_BuildRegular( FeEquationNumber* self ) {
+   int nLocals, nDomains;
+   int varInd;
+   int **dstArray;
+   int nDofs;
+   Comm *comm;
+   MPI_Comm mpiComm;
+   int nRanks, rank;
+   Sync *sync;
+   Bool isCond;
+   int nOwned, base, total;
+   int *counts;
+   int ii, jj;
+
+   comm = Mesh_GetCommTopology( self->feMesh, 0 );
+   mpiComm = Comm_GetMPIComm( comm );
+   MPI_Comm_size( mpiComm, &nRanks );
+   MPI_Comm_rank( mpiComm, &rank );
+
+   /* Allocate for destination array. */
+   nLocals = Mesh_GetLocalSize( self->feMesh, 0 );
+   nDomains = Mesh_GetDomainSize( self->feMesh, 0 );
+   nDofs = self->dofLayout->dofCounts[0];
+   dstArray = AllocArray2D( int, nDomains, nDofs );
+
+   /* Number the owned dofs in local order, skipping dirichlet BCs. */
+   nOwned = 0;
+   for( ii = 0; ii < nLocals; ii++ )
+   {
+      for( jj = 0; jj < nDofs; jj++ )
+      {
+         varInd = self->dofLayout->varIndices[ii][jj];
+         if( self->bcs )
+            isCond = VariableCondition_IsCondition( self->bcs, ii, varInd );
+         else
+            isCond = False;
+
+         if( isCond && self->removeBCs )
+            dstArray[ii][jj] = -1;
+         else
+            dstArray[ii][jj] = nOwned++;
+      }
+   }
+
+   /* Offset by the counts on lower ranks. The counts are gathered rather than scanned, as
+      every rank needs the lowest eq num of the others anyway. */
+   counts = AllocArray( int, nRanks );
+   (void)MPI_Allgather( &nOwned, 1, MPI_INT, counts, 1, MPI_INT, mpiComm );
+   self->_lowestGlobalEqNums = AllocArray( int, nRanks );
+   total = 0;
+   for( ii = 0; ii < nRanks; ii++ )
+   {
+      self->_lowestGlobalEqNums[ii] = total;
+      total += counts[ii];
+   }
+   FreeArray( counts );
+   base = self->_lowestGlobalEqNums[rank];
+   for( ii = 0; ii < nLocals * nDofs; ii++ )
+   {
+      if( dstArray[0][ii] != -1 )
+         dstArray[0][ii] += base;
+   }
+
+   /* Transfer remote equation numbers. */
+   sync = Mesh_GetSync( self->feMesh, 0 );
+   Sync_SyncArray( sync, dstArray[0], nDofs * sizeof(int),
+                   dstArray[0] + nLocals * nDofs, nDofs * sizeof(int),
+                   nDofs * sizeof(int) );
+
+   /* Setup owned mapping; owned eq nums are contiguous, so each maps to its offset. */
+   STree_Clear( self->ownedMap );
+   for( ii = 0; ii < nOwned; ii++ )
+   {
+      jj = base + ii;
+      STreeMap_Insert( self->ownedMap, &jj, &ii );
+   }
+
+   self->mapNodeDof2Eq = dstArray;
+   FeEquationNumber_BuildLocationMatrix( self );
+   self->remappingActivated = False;
+   self->localEqNumsOwnedCount = nOwned;
+   self->firstOwnedEqNum = base;
+   self->lastOwnedEqNum = base + nOwned - 1;
+   self->_lowestLocalEqNum = base;
+   self->globalSumUnconstrainedDofs = total;
 }
 
 void FeEquationNumber_BuildWithDave( FeEquationNumber* self ) {
@@ -809,12 +887,9 @@ void FeEquationNumber_BuildWithDave( FeEquationNumber* self ) {
    Grid *vGrid;
    int varInd;
    int nEqNums, **dstArray;
-   IArray *inc;
    int nDofs;
    int *periodic;
-   int ***locMat;
    int nDims;
-   int *elNodes;
    Comm *comm;
    MPI_Comm mpiComm;
    int nRanks, rank;
@@ -827,7 +902,7 @@ void FeEquationNumber_BuildWithDave( FeEquationNumber* self ) {
    int *tmpArray, nLocalEqNums;
    int lastOwnedEqNum, ind;
    STree *doneSet;
-   int ii, jj, kk;
+   int ii, jj;
 
    comm = Mesh_GetCommTopology( self->feMesh, 0 );
    mpiComm = Comm_GetMPIComm( comm );
@@ -995,31 +1070,9 @@ void FeEquationNumber_BuildWithDave( FeEquationNumber* self ) {
                    dstArray[0] + nLocals * nDofs, nDofs * sizeof(int),
                    nDofs * sizeof(int) );
 
-   /* Allocate for location matrix. */
-   /* first store nDomainEls for usage during destroy */
-   self->nDomainEls = Mesh_GetDomainSize( self->feMesh, nDims );
-   locMat = AllocArray( int**, self->nDomainEls );
-   for( ii = 0; ii < self->nDomainEls; ii++ )
-      locMat[ii] = AllocArray2D( int, FeMesh_GetElementNodeSize( self->feMesh, 0 ), nDofs );
-
-   /* Fill in location matrix. */
-   inc = IArray_New();
-   for( ii = 0; ii < Mesh_GetDomainSize( self->feMesh, nDims ); ii++ )
-   {
-      FeMesh_GetElementNodes( self->feMesh, ii, inc );
-      elNodes = IArray_GetPtr( inc );
-      for( jj = 0; jj < FeMesh_GetElementNodeSize( self->feMesh, 0 ); jj++ )
-      {
-         for( kk = 0; kk < nDofs; kk++ )
-         locMat[ii][jj][kk] = dstArray[elNodes[jj]][kk];
-      }
-   }
-   Stg_Class_Delete( inc );
-
    /* Fill in our other weird values. */
    self->mapNodeDof2Eq = dstArray;
-   self->locationMatrix = locMat;
-   self->locationMatrixBuilt = True;
+   FeEquationNumber_BuildLocationMatrix( self );
    self->remappingActivated = False;
    self->localEqNumsOwnedCount = nLocalEqNums;
 
@@ -94,6 +94,10 @@
 		unsigned int				globalSumUnconstrainedDofs; \
 		/** map of (domain element, elementLocalNode,  nodeLocalDof) -> global eq. num */ \
 		Dof_EquationNumber***	locationMatrix; \
+		/** storage behind locationMatrix: each element's eq nums are contiguous in one flat \
+		    array, with a row pointer per element node into it */ \
+		Dof_EquationNumber**		locationMatrixRows; \
+		Dof_EquationNumber*		locationMatrixEqNums; \
 		/** Records whether someone has tried to build the eqNum table yet */ \
 		/** Bool to make sure LM only gets built once */ \
 		Bool							locationMatrixBuilt; \
@@ -195,7 +199,9 @@
 	trying ghosting again */
 	Partition_Index FeEquationNumber_CalculateOwningProcessorOfEqNum( void* self, Dof_EquationNumber eqNum );
 
-	/** build the processor's location matrix mapping elements, element node, dof -> eq num */
+	/** build the processor's location matrix mapping elements, element node, dof -> eq num.
+	All eq nums are stored in a single flat array, so those of element e run contiguously
+	from locationMatrix[e][0]. */
 	void FeEquationNumber_BuildLocationMatrix( void* feEquationNumber );
 
 	/** Calculates the total number of active (i.e. Non BC) dofs at a given node */
@@ -234,7 +240,10 @@
 
 	void FeEquationNumber_BuildWithTopology( FeEquationNumber* self );
 
-	/* void FeEquationNumber_BuildRegular( FeEquationNumber* self ); */
+	/** Numbers a vertex grid mesh without periodicity: owned, unconstrained dofs are numbered
+	in local order, offset by a prefix sum of the counts on lower ranks, and shadow eq nums
+	are filled from their owners by a single halo exchange. */
+	void FeEquationNumber_BuildRegular( FeEquationNumber* self );
 
 	void FeEquationNumber_BuildWithDave( FeEquationNumber* self );
 
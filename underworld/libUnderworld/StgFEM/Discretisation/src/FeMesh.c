@@ -182,8 +182,11 @@ void _FeMesh_Build( void* feMesh, void* data ) {
 	else
 		abort();
 	FeMesh_SetElementType( self, elType );
-	if( self->feElType )
+	if( self->feElType ) {
 		Stg_Component_Build( self->feElType, data, False );
+		/* Cache Jacobians of affine elements, this only kicks in for regular meshes. */
+		ElementType_SetJacobianCaching( self->feElType, self, True );
+	}
 
     if( !self->elementMesh && self->useFeAlgorithms ) {
         /* We need to swap to the FeMesh element type because the
@@ -245,6 +248,15 @@ void FeMesh_SetElementFamily( void* feMesh, const char* family ) {
 	self->feElFamily = (char*)family;
 }
 
+void FeMesh_SetJacobianCaching( void* feMesh, Bool cache ) {
+	FeMesh*	self = (FeMesh*)feMesh;
+
+	assert( self );
+
+	if( self->feElType )
+		ElementType_SetJacobianCaching( self->feElType, self, cache );
+}
+
 ElementType* FeMesh_GetElementType( void* feMesh, unsigned element ) {
 	FeMesh*	self = (FeMesh*)feMesh;
 
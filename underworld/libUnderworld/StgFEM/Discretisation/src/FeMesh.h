@@ -75,6 +75,8 @@
 
 	void FeMesh_SetElementFamily( void* feMesh, const char* family );
 	void FeMesh_SetElementType( void* feMesh, ElementType* elType );
+	/** Enables/disables caching of the Jacobians of affine elements on regular meshes. On by default. */
+	void FeMesh_SetJacobianCaching( void* feMesh, Bool cache );
 
 	ElementType* FeMesh_GetElementType( void* feMesh, unsigned element );
 
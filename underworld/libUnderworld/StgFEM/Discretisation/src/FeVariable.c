@@ -1002,6 +1002,115 @@ void FeVariable_PrintCoordsAndValues( void* _feVariable, Stream* stream ) {
    }
 }
 
+typedef struct {
+   long global;
+   int  local;
+} FeVariable_DatasetRow;
+
+static int _FeVariable_CompareDatasetRows( const void* a, const void* b ) {
+   long ga = ((const FeVariable_DatasetRow*)a)->global;
+   long gb = ((const FeVariable_DatasetRow*)b)->global;
+
+   return ( ga > gb ) - ( ga < gb );
+}
+
+/*
+ * Builds the file type selecting this processor's rows of the dataset, one row per local
+ * node at its global index. MPI-IO requires increasing file displacements, so the local
+ * node indices are returned in the same (increasing global index) order.
+ */
+static void _FeVariable_DatasetType( FeVariable* self, int** nodes, int* nodeCount, MPI_Datatype* rowType, MPI_Datatype* fileType ) {
+   FeMesh*                mesh = self->feMesh;
+   Node_LocalIndex        lNodeCount = FeMesh_GetNodeLocalSize( mesh );
+   SizeT                  rowBytes = self->fieldComponentCount * sizeof(double);
+   FeVariable_DatasetRow* rows;
+   MPI_Aint*              displacements;
+   Node_LocalIndex        lNode_I;
+
+   rows = Memory_Alloc_Array( FeVariable_DatasetRow, lNodeCount, "FeVariable_DatasetRow" );
+   for( lNode_I = 0; lNode_I < lNodeCount; lNode_I++ ) {
+      rows[lNode_I].global = Mesh_DomainToGlobal( mesh, MT_VERTEX, lNode_I );
+      rows[lNode_I].local = lNode_I;
+   }
+   qsort( rows, lNodeCount, sizeof(FeVariable_DatasetRow), _FeVariable_CompareDatasetRows );
+
+   *nodes = Memory_Alloc_Array( int, lNodeCount, "nodes" );
+   displacements = Memory_Alloc_Array( MPI_Aint, lNodeCount, "displacements" );
+   for( lNode_I = 0; lNode_I < lNodeCount; lNode_I++ ) {
+      (*nodes)[lNode_I] = rows[lNode_I].local;
+      displacements[lNode_I] = (MPI_Aint)rows[lNode_I].global * rowBytes;
+   }
+   *nodeCount = lNodeCount;
+
+   MPI_Type_contiguous( self->fieldComponentCount, MPI_DOUBLE, rowType );
+   MPI_Type_commit( rowType );
+   MPI_Type_create_hindexed_block( lNodeCount, 1, displacements, *rowType, fileType );
+   MPI_Type_commit( fileType );
+
+   Memory_Free( displacements );
+   Memory_Free( rows );
+}
+
+void FeVariable_WriteDataset( void* feVariable, const char* filename, long offset ) {
+   FeVariable*  self = (FeVariable*)feVariable;
+   MPI_Comm     comm = Comm_GetMPIComm( Mesh_GetCommTopology( self->feMesh, MT_VERTEX ) );
+   Index        nComp = self->fieldComponentCount;
+   int*         nodes;
+   int          nodeCount, node_I, ierr;
+   double*      values;
+   MPI_Datatype rowType, fileType;
+   MPI_File     fh;
+
+   _FeVariable_DatasetType( self, &nodes, &nodeCount, &rowType, &fileType );
+
+   /* Pack the local values in file order. */
+   values = Memory_Alloc_Array( double, nodeCount * nComp, "values" );
+   for( node_I = 0; node_I < nodeCount; node_I++ )
+      FeVariable_GetValueAtNode( self, nodes[node_I], values + node_I * nComp );
+
+   ierr = MPI_File_open( comm, (char*)filename, MPI_MODE_WRONLY, MPI_INFO_NULL, &fh );
+   Journal_Firewall( ierr == MPI_SUCCESS, NULL,
+      "Error in func %s: unable to open file '%s' to write FeVariable '%s'.\n", __func__, filename, self->name );
+   MPI_File_set_view( fh, (MPI_Offset)offset, rowType, fileType, "native", MPI_INFO_NULL );
+   MPI_File_write_all( fh, values, nodeCount, rowType, MPI_STATUS_IGNORE );
+   MPI_File_close( &fh );
+
+   MPI_Type_free( &fileType );
+   MPI_Type_free( &rowType );
+   Memory_Free( values );
+   Memory_Free( nodes );
+}
+
+void FeVariable_ReadDataset( void* feVariable, const char* filename, long offset ) {
+   FeVariable*  self = (FeVariable*)feVariable;
+   MPI_Comm     comm = Comm_GetMPIComm( Mesh_GetCommTopology( self->feMesh, MT_VERTEX ) );
+   Index        nComp = self->fieldComponentCount;
+   int*         nodes;
+   int          nodeCount, node_I, ierr;
+   double*      values;
+   MPI_Datatype rowType, fileType;
+   MPI_File     fh;
+
+   _FeVariable_DatasetType( self, &nodes, &nodeCount, &rowType, &fileType );
+   values = Memory_Alloc_Array( double, nodeCount * nComp, "values" );
+
+   ierr = MPI_File_open( comm, (char*)filename, MPI_MODE_RDONLY, MPI_INFO_NULL, &fh );
+   Journal_Firewall( ierr == MPI_SUCCESS, NULL,
+      "Error in func %s: unable to open file '%s' to read FeVariable '%s'.\n", __func__, filename, self->name );
+   MPI_File_set_view( fh, (MPI_Offset)offset, rowType, fileType, "native", MPI_INFO_NULL );
+   MPI_File_read_all( fh, values, nodeCount, rowType, MPI_STATUS_IGNORE );
+   MPI_File_close( &fh );
+
+   for( node_I = 0; node_I < nodeCount; node_I++ )
+      FeVariable_SetValueAtNode( self, nodes[node_I], values + node_I * nComp );
+   FeVariable_SyncShadowValues( self );
+
+   MPI_Type_free( &fileType );
+   MPI_Type_free( &rowType );
+   Memory_Free( values );
+   Memory_Free( nodes );
+}
+
 #define MAX_ELEMENT_NODES 27
 /* --- Private Functions --- */
 void _FeVariable_InterpolateNodeValuesToElLocalCoord(
@@ -289,6 +289,20 @@
 
    void FeVariable_GetMinimumSeparation( void* feVariable, double* minSeparationPtr, double minSeparationEachDim[3] );
 
+   /*
+    * Writes the values at the local nodes to a contiguous (nodesGlobal x components) double
+    * dataset starting at byte offset 'offset' within the file, at the rows given by the
+    * global node indices. The file must already exist. Collective.
+    */
+   void FeVariable_WriteDataset( void* feVariable, const char* filename, long offset );
+
+   /*
+    * Reads the values at the local nodes from a dataset written by FeVariable_WriteDataset,
+    * and synchronises the shadow values. As the rows are indexed by global node, the dataset
+    * may have been written using any number of processors. Collective.
+    */
+   void FeVariable_ReadDataset( void* feVariable, const char* filename, long offset );
+
    /*
     * Synchronises each processor's shadow dof values to be the same as the values on their "home" processors.
     * Collective.
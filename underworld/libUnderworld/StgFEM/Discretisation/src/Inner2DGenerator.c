@@ -293,6 +293,7 @@ void Inner2DGenerator_BuildGeometry( Inner2DGenerator* self, FeMesh* mesh ) {
 	unsigned	nDims;
 	unsigned	nDomainEls;
 	unsigned	e_i;
+	const Bool*	moved;
 
 	assert( self );
 	assert( mesh );
@@ -300,11 +301,15 @@ void Inner2DGenerator_BuildGeometry( Inner2DGenerator* self, FeMesh* mesh ) {
 	elMesh = self->elMesh;
 	nDims = Mesh_GetDimSize( elMesh );
 	nDomainEls = Mesh_GetDomainSize( elMesh, nDims );
+	/* once generated, only the elements moved since the last generation need updating */
+	moved = mesh->vertices ? Mesh_GetMovedElements( elMesh, mesh->parentMeshVersion ) : NULL;
 
 	if( nDims == 2 ) {
         Mesh_GenerateVertices( mesh, nDomainEls * 3, nDims );
 
 		for( e_i = 0; e_i < nDomainEls; e_i++ ) {
+			if( moved && !moved[e_i] )
+				continue;
 			unsigned elInd = e_i * 3;
 
 			FeMesh_CoordLocalToGlobal( elMesh, e_i, localCrds[0], globalCrd );
@@ -331,6 +336,8 @@ void Inner2DGenerator_BuildGeometry( Inner2DGenerator* self, FeMesh* mesh ) {
         Mesh_GenerateVertices( mesh, nDomainEls * 4, nDims );
 
 		for( e_i = 0; e_i < nDomainEls; e_i++ ) {
+			if( moved && !moved[e_i] )
+				continue;
 			unsigned elInd = e_i * 4;
 
 			FeMesh_CoordLocalToGlobal( elMesh, e_i, localCrds3D[0], globalCrd3D );
@@ -350,6 +357,7 @@ void Inner2DGenerator_BuildGeometry( Inner2DGenerator* self, FeMesh* mesh ) {
 			memcpy( vert, globalCrd3D, nDims * sizeof(double) );
 		}
 	}
+	mesh->parentMeshVersion = elMesh->geometryVersion;
 }
 
 void Inner2DGenerator_BuildElementTypes( Inner2DGenerator* self, FeMesh* mesh ) {
@@ -265,6 +265,7 @@ void dQ1Generator_BuildGeometry( dQ1Generator* self, FeMesh* mesh ) {
 	unsigned	nDims;
 	unsigned	nDomainEls;
 	unsigned	e_i;
+	const Bool*	moved;
 
 	assert( self );
 	assert( mesh );
@@ -272,10 +273,14 @@ void dQ1Generator_BuildGeometry( dQ1Generator* self, FeMesh* mesh ) {
 	elMesh = self->elMesh;
 	nDims = Mesh_GetDimSize( elMesh );
 	nDomainEls = Mesh_GetDomainSize( elMesh, nDims );
+	/* once generated, only the elements moved since the last generation need updating */
+	moved = mesh->vertices ? Mesh_GetMovedElements( elMesh, mesh->parentMeshVersion ) : NULL;
 
 	if( nDims == 2 ) {
       Mesh_GenerateVertices( mesh, nDomainEls * 4, nDims );
       for( e_i = 0; e_i < nDomainEls; e_i++ ) {
+        if( moved && !moved[e_i] )
+          continue;
         unsigned elInd = e_i * 4;
         int node;
         for(node=0; node<4; node++){
@@ -297,6 +302,8 @@ void dQ1Generator_BuildGeometry( dQ1Generator* self, FeMesh* mesh ) {
       double globalCrd3D[3];
       Mesh_GenerateVertices( mesh, nDomainEls * 8, nDims );     
       for( e_i = 0; e_i < nDomainEls; e_i++ ) {
+        if( moved && !moved[e_i] )
+          continue;
         unsigned elInd = e_i * 8;
         int node;
         node;
@@ -307,6 +314,7 @@ void dQ1Generator_BuildGeometry( dQ1Generator* self, FeMesh* mesh ) {
         }
       }//for
 	}//else nDims == 3
+	mesh->parentMeshVersion = elMesh->geometryVersion;
 }
 
 void dQ1Generator_BuildElementTypes( dQ1Generator* self, FeMesh* mesh ) {
@@ -268,6 +268,56 @@ void ElementTypeSuite_TestQuadratic3D( ElementTypeSuiteData* data ) {
    Stg_Component_Destroy( feMesh, NULL, True );   
 }
 
+/* the cached Jacobians are rebuilt by the first conversion after the mesh is built or deformed */
+void ElementTypeSuite_TestConvertAfterDeformation( ElementTypeSuiteData* data ) {
+   FeMesh*      feMesh;
+   ElementType* elType;
+   IArray*      inc = IArray_New();
+   int*         elNodes;
+   Coord        gCoord, lCoord;
+   double       xi[2] = { 0.3, -0.4 };
+   double       Ni[4];
+   double*      vert;
+   unsigned     nVerts, v_i, elNode_i, pass;
+   int          dim = 2;
+   unsigned     sizes[3] = { 6, 6, 1 };
+   double       minCrd[3] = { 0.0, 0.0, 0.0 };
+   double       maxCrd[3] = { 1.2, 1.2, 1.2 };
+
+   feMesh = BuildMeshLinear( dim, sizes, minCrd, maxCrd );
+   elType = FeMesh_GetElementType( feMesh, 0 );
+   nVerts = Mesh_GetDomainSize( feMesh, MT_VERTEX );
+
+   for( pass = 0; pass < 2; pass++ ) {
+      if( pass ) {
+         /* stretch and shift the mesh, which keeps it regular */
+         for( v_i = 0; v_i < nVerts; v_i++ ) {
+            vert = Mesh_GetVertex( feMesh, v_i );
+            vert[I_AXIS] = 2.0 * vert[I_AXIS] + 0.5;
+            vert[J_AXIS] = 0.5 * vert[J_AXIS] - 1.0;
+         }
+         Mesh_DeformationUpdate( feMesh );
+      }
+
+      /* map a local coordinate of the first element to global, and back */
+      ElementType_EvaluateShapeFunctionsAt( elType, xi, Ni );
+      Mesh_GetIncidence( feMesh, dim, 0, MT_VERTEX, inc );
+      elNodes = IArray_GetPtr( inc );
+      memset( gCoord, 0, sizeof( double ) * dim );
+      for( elNode_i = 0; elNode_i < FeMesh_GetElementNodeSize( feMesh, 0 ); elNode_i++ ) {
+         gCoord[I_AXIS] += Ni[elNode_i] * Mesh_GetVertex( feMesh, elNodes[elNode_i] )[I_AXIS];
+         gCoord[J_AXIS] += Ni[elNode_i] * Mesh_GetVertex( feMesh, elNodes[elNode_i] )[J_AXIS];
+      }
+
+      _ElementType_ConvertGlobalCoordToElLocal( elType, feMesh, 0, gCoord, lCoord );
+      pcu_check_true( fabs( lCoord[I_AXIS] - xi[I_AXIS] ) < TOLERANCE );
+      pcu_check_true( fabs( lCoord[J_AXIS] - xi[J_AXIS] ) < TOLERANCE );
+   }
+
+   Stg_Class_Delete( inc );
+   Stg_Component_Destroy( feMesh, NULL, True );
+}
+
 void ElementTypeSuite_TestSurfaceJacobian_Linear2D( ElementTypeSuiteData* data ) {
    FeMesh*      feMesh;
    ElementType* elType;
@@ -507,6 +557,7 @@ void ElementTypeSuite( pcu_suite_t* suite ) {
    pcu_suite_addTest( suite, ElementTypeSuite_TestLinear3D );
    pcu_suite_addTest( suite, ElementTypeSuite_TestQuadratic2D );
    pcu_suite_addTest( suite, ElementTypeSuite_TestQuadratic3D );
+   pcu_suite_addTest( suite, ElementTypeSuite_TestConvertAfterDeformation );
    pcu_suite_addTest( suite, ElementTypeSuite_TestSurfaceJacobian_Linear2D );
    pcu_suite_addTest( suite, ElementTypeSuite_TestSurfaceJacobian_Linear3D );
    pcu_suite_addTest( suite, ElementTypeSuite_TestSurfaceJacobian_Quadratic2D );
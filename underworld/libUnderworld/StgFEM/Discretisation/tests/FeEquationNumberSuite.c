@@ -0,0 +1,147 @@
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*
+**                                                                                  **
+** This file forms part of the Underworld geophysics modelling application.         **
+**                                                                                  **
+** For full license and copyright information, please refer to the LICENSE.md file  **
+** located at the project root, or contact the authors.                             **
+**                                                                                  **
+**~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pcu/pcu.h"
+#include <StGermain/libStGermain/src/StGermain.h>
+#include <StgDomain/libStgDomain/src/StgDomain.h>
+#include <StgFEM/Discretisation/Discretisation.h>
+#include "FeEquationNumberSuite.h"
+
+typedef struct {
+   FeMesh*            feMesh;
+   Variable_Register* varReg;
+   StgVariable*       var;
+   DofLayout*         dofs;
+   IndexSet*          wall;
+   PythonVC*          bcs;
+   double*            arrayPtrs[2];
+   int                arraySize;
+} FeEquationNumberSuiteData;
+
+void FeEquationNumberSuite_Setup( FeEquationNumberSuiteData* data ) {
+   CartesianGenerator* gen;
+   int                 maxDecomp[2] = {0, 1};
+   int                 sizes[2];
+   double              minCrd[2] = {0.0, 0.0};
+   double              maxCrd[2] = {1.0, 1.0};
+   int                 nRanks;
+   unsigned            vcInd;
+   int                 n_i;
+
+   MPI_Comm_size( MPI_COMM_WORLD, &nRanks );
+   sizes[0] = nRanks * 4;
+   sizes[1] = 4;
+
+   gen = CartesianGenerator_New( "", NULL );
+   CartesianGenerator_SetDimSize( gen, 2 );
+   CartesianGenerator_SetTopologyParams( gen, (unsigned*)sizes, 0, NULL, (unsigned*)maxDecomp );
+   CartesianGenerator_SetGeometryParams( gen, minCrd, maxCrd );
+
+   data->feMesh = FeMesh_New( "" );
+   Mesh_SetGenerator( data->feMesh, gen );
+   FeMesh_SetElementFamily( data->feMesh, "linear" );
+   Stg_Component_Build( data->feMesh, NULL, False );
+
+   data->varReg = Variable_Register_New();
+   data->arraySize = Mesh_GetDomainSize( data->feMesh, MT_VERTEX );
+   data->arrayPtrs[0] = Memory_Alloc_Array_Unnamed( double, data->arraySize * 2 );
+   data->var = StgVariable_NewVector( "velocity", NULL, StgVariable_DataType_Double, 2, (unsigned*)&data->arraySize, NULL,
+      (void**)data->arrayPtrs, data->varReg, "vx", "vy" );
+   Variable_Register_BuildAll( data->varReg );
+
+   data->dofs = DofLayout_New( "", data->varReg, 0, data->feMesh );
+   data->dofs->nBaseVariables = 2;
+   data->dofs->baseVariables = Memory_Alloc_Array_Unnamed( StgVariable*, 2 );
+   data->dofs->baseVariables[0] = data->var->components[0];
+   data->dofs->baseVariables[1] = data->var->components[1];
+   Stg_Component_Build( data->dofs, NULL, False );
+   Stg_Component_Initialise( data->dofs, NULL, False );
+
+   /* Fix the x velocity on the left wall, on whichever rank holds it. */
+   data->wall = IndexSet_New( data->arraySize );
+   for( n_i = 0; n_i < data->arraySize; n_i++ ) {
+      if( Mesh_GetVertex( data->feMesh, n_i )[0] < minCrd[0] + 1e-10 )
+         IndexSet_Add( data->wall, n_i );
+   }
+   data->bcs = _PythonVC_DefaultNew( "" );
+   _PythonVC_SetupIndexSetArray( data->bcs, data->varReg->count );
+   vcInd = Variable_Register_GetIndex( data->varReg, "vx" );
+   _PythonVC_SetIndexSetAtArrayPosition( data->bcs, data->wall, vcInd );
+}
+
+void FeEquationNumberSuite_Teardown( FeEquationNumberSuiteData* data ) {
+   Stg_Class_Delete( data->bcs );
+   Stg_Class_Delete( data->wall );
+   Stg_Component_Destroy( data->dofs, NULL, True );
+   Stg_Class_Delete( data->varReg );
+   Memory_Free( data->arrayPtrs[0] );
+   Stg_Component_Destroy( data->feMesh, NULL, True );
+}
+
+FeEquationNumber* FeEquationNumberSuite_NewEqNum( FeEquationNumberSuiteData* data, Bool useBCs ) {
+   FeEquationNumber* eqNum;
+
+   eqNum = FeEquationNumber_New( "", NULL, data->feMesh, data->dofs, useBCs ? (VariableCondition*)data->bcs : NULL, NULL );
+   memset( eqNum->periodic, 0, 3 * sizeof(Bool) );
+
+   return eqNum;
+}
+
+/* Numbers the same mesh with the regular routine and with the generic one, and checks the
+   equation number of every domain dof agrees, along with the ownership counts. */
+void FeEquationNumberSuite_CompareNumberings( FeEquationNumberSuiteData* data, Bool useBCs ) {
+   FeEquationNumber* regular;
+   FeEquationNumber* generic;
+   int               nDomains, nDofs;
+   int               nBCs;
+   int               n_i, dof_i;
+
+   regular = FeEquationNumberSuite_NewEqNum( data, useBCs );
+   FeEquationNumber_BuildRegular( regular );
+   generic = FeEquationNumberSuite_NewEqNum( data, useBCs );
+   FeEquationNumber_BuildWithDave( generic );
+
+   nDomains = Mesh_GetDomainSize( data->feMesh, MT_VERTEX );
+   nDofs = data->dofs->dofCounts[0];
+   nBCs = 0;
+   for( n_i = 0; n_i < nDomains; n_i++ ) {
+      for( dof_i = 0; dof_i < nDofs; dof_i++ ) {
+         pcu_check_true( regular->mapNodeDof2Eq[n_i][dof_i] == generic->mapNodeDof2Eq[n_i][dof_i] );
+         if( regular->mapNodeDof2Eq[n_i][dof_i] == -1 )
+            nBCs++;
+      }
+   }
+   pcu_check_true( nBCs == (useBCs ? (int)IndexSet_UpdateMembersCount( data->wall ) : 0) );
+
+   pcu_check_true( regular->localEqNumsOwnedCount == generic->localEqNumsOwnedCount );
+   pcu_check_true( regular->globalSumUnconstrainedDofs == generic->globalSumUnconstrainedDofs );
+   pcu_check_true( regular->_lowestLocalEqNum == generic->_lowestLocalEqNum );
+
+   Stg_Component_Destroy( regular, NULL, True );
+   Stg_Component_Destroy( generic, NULL, True );
+}
+
+void FeEquationNumberSuite_TestRegularMatchesGeneric( FeEquationNumberSuiteData* data ) {
+   FeEquationNumberSuite_CompareNumberings( data, False );
+}
+
+void FeEquationNumberSuite_TestRegularMatchesGenericWithBCs( FeEquationNumberSuiteData* data ) {
+   FeEquationNumberSuite_CompareNumberings( data, True );
+}
+
+void FeEquationNumberSuite( pcu_suite_t* suite ) {
+   pcu_suite_setData( suite, FeEquationNumberSuiteData );
+   pcu_suite_setFixtures( suite, FeEquationNumberSuite_Setup, FeEquationNumberSuite_Teardown );
+   pcu_suite_addTest( suite, FeEquationNumberSuite_TestRegularMatchesGeneric );
+   pcu_suite_addTest( suite, FeEquationNumberSuite_TestRegularMatchesGenericWithBCs );
+}
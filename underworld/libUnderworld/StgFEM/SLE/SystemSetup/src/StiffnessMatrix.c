@@ -164,6 +164,7 @@ void _StiffnessMatrix_Init(
     self->dim = dim;
     self->isNonLinear = isNonLinear;
     self->assembleOnNodes = assembleOnNodes;
+    self->assemblyVersion = 0;
 
     self->rowLocalSize = 0;
     self->colLocalSize = 0;
@@ -361,7 +362,7 @@ void StiffnessMatrix_Assemble( void* stiffnessMatrix, void* _sle, void* _context
     StiffnessMatrix_RefreshMatrix( self );
 
     self->_assemblyFunction( self, _sle, _context );
-
+    self->assemblyVersion++;
 }
 
 
@@ -560,15 +561,17 @@ void __StiffnessMatrix_NewAssemble( void* stiffnessMatrix, void* _sle, void* _co
     unsigned			nRowEls;
     int			nRowNodes, *rowNodes;
     int			nColNodes, *colNodes;
-    unsigned			maxDofs, maxRCDofs, nDofs, nRowDofs, nColDofs;
+    unsigned			maxDofs, maxRCDofs, maxMaskDofs, nDofs, nRowDofs, nColDofs;
     double**			elStiffMat;
     double*				bcVals;
+    Bool				*rowBCs, *colBCs;
+    double				*rowBCVals, *colBCVals;
+    Bool				keepBCs, hasRowBCs, hasColBCs;
     Mat                             matrix = self->matrix;
     Vec				vector, transVector;
     int nRowNodeDofs, nColNodeDofs;
     int rowInd, colInd;
-    double bc;
-    unsigned			e_i, n_i, dof_i, n_j, dof_j;
+    unsigned			e_i, n_i, dof_i;
 
     assert( self && Stg_CheckType( self, StiffnessMatrix ) );
 
@@ -586,9 +589,13 @@ void __StiffnessMatrix_NewAssemble( void* stiffnessMatrix, void* _sle, void* _co
     //matrix = self->matrix;
     vector = self->rhs ? self->rhs->vector : NULL;
     transVector = self->transRHS ? self->transRHS->vector : NULL;
+    keepBCs = ( !rowEqNum->removeBCs || !colEqNum->removeBCs ) ? True : False;
     elStiffMat = NULL;
     bcVals = NULL;
+    rowBCs = colBCs = NULL;
+    rowBCVals = colBCVals = NULL;
     maxDofs = 0;
+    maxMaskDofs = 0;
 
     /* Begin assembling each element. */
     for( e_i = 0; e_i < nRowEls; e_i++ ) {
@@ -618,59 +625,69 @@ void __StiffnessMatrix_NewAssemble( void* stiffnessMatrix, void* _sle, void* _co
             self->elStiffMat = elStiffMat;
             self->bcVals = bcVals;
         }
+        if( nRowDofs + nColDofs > maxMaskDofs ) {
+            maxMaskDofs = nRowDofs + nColDofs;
+            rowBCs = ReallocArray( rowBCs, Bool, maxMaskDofs );
+            rowBCVals = ReallocArray( rowBCVals, double, maxMaskDofs );
+        }
+        colBCs = rowBCs + nRowDofs;
+        colBCVals = rowBCVals + nRowDofs;
+
+        /* Build the element's BC mask, so each dof is only queried once rather than once per
+           row/column pair below. Elements with no BC'd dofs skip the corrections entirely. */
+        hasRowBCs = False;
+        rowInd = 0;
+        for( n_i = 0; n_i < nRowNodes; n_i++ ) {
+            nRowNodeDofs = rowDofs->dofCounts[rowNodes[n_i]];
+            for( dof_i = 0; dof_i < nRowNodeDofs; dof_i++ ) {
+                rowBCs[rowInd] = FeVariable_IsBC( rowVar, rowNodes[n_i], dof_i );
+                if( rowBCs[rowInd] ) {
+                    rowBCVals[rowInd] = DofLayout_GetValueDouble( rowDofs, rowNodes[n_i], dof_i );
+                    hasRowBCs = True;
+                }
+                rowInd++;
+            }
+        }
+        hasColBCs = False;
+        colInd = 0;
+        for( n_i = 0; n_i < nColNodes; n_i++ ) {
+            nColNodeDofs = colDofs->dofCounts[colNodes[n_i]];
+            for( dof_i = 0; dof_i < nColNodeDofs; dof_i++ ) {
+                colBCs[colInd] = FeVariable_IsBC( colVar, colNodes[n_i], dof_i );
+                if( colBCs[colInd] ) {
+                    colBCVals[colInd] = DofLayout_GetValueDouble( colDofs, colNodes[n_i], dof_i );
+                    hasColBCs = True;
+                }
+                colInd++;
+            }
+        }
 
         /* Assemble the element. */
         memset( elStiffMat[0], 0, nDofs * sizeof(double) );
         StiffnessMatrix_AssembleElement( self, e_i, sle, _context, elStiffMat );
 
         /* Correct for BCs providing I'm not keeping them in. */
-        if( vector ) {
+        if( vector && hasColBCs ) {
             memset( bcVals, 0, nRowDofs * sizeof(double) );
-
-            rowInd = 0;
-            for( n_i = 0; n_i < nRowNodes; n_i++ ) {
-                nRowNodeDofs = rowDofs->dofCounts[rowNodes[n_i]];
-                for( dof_i = 0; dof_i < nRowNodeDofs; dof_i++ ) {
-                    if( !FeVariable_IsBC( rowVar, rowNodes[n_i], dof_i ) ) {
-                        colInd = 0;
-                        for( n_j = 0; n_j < nColNodes; n_j++ ) {
-                            nColNodeDofs = colDofs->dofCounts[colNodes[n_j]];
-                            for( dof_j = 0; dof_j < nColNodeDofs; dof_j++ ) {
-                                if( FeVariable_IsBC( colVar, colNodes[n_j], dof_j ) ) {
-                                    bc = DofLayout_GetValueDouble( colDofs, colNodes[n_j], dof_j );
-                                    bcVals[rowInd] -= bc * elStiffMat[rowInd][colInd];
-                                }
-                                colInd++;
-                            }
-                        }
-                    }
-                    rowInd++;
+            for( rowInd = 0; rowInd < nRowDofs; rowInd++ ) {
+                if( rowBCs[rowInd] )
+                    continue;
+                for( colInd = 0; colInd < nColDofs; colInd++ ) {
+                    if( colBCs[colInd] )
+                        bcVals[rowInd] -= colBCVals[colInd] * elStiffMat[rowInd][colInd];
                 }
             }
 
             VecSetValues( vector, nRowDofs, (int*)rowEqNum->locationMatrix[e_i][0], bcVals, ADD_VALUES );
         }
-        if( transVector ) {
+        if( transVector && hasRowBCs ) {
             memset( bcVals, 0, nColDofs * sizeof(double) );
-
-            colInd = 0;
-            for( n_i = 0; n_i < nColNodes; n_i++ ) {
-                nColNodeDofs = colDofs->dofCounts[colNodes[n_i]];
-                for( dof_i = 0; dof_i < nColNodeDofs; dof_i++ ) {
-                    if( !FeVariable_IsBC( colVar, colNodes[n_i], dof_i ) ) {
-                        rowInd = 0;
-                        for( n_j = 0; n_j < nRowNodes; n_j++ ) {
-                            nRowNodeDofs = rowDofs->dofCounts[rowNodes[n_j]];
-                            for( dof_j = 0; dof_j < nRowNodeDofs; dof_j++ ) {
-                                if( FeVariable_IsBC( rowVar, rowNodes[n_j], dof_j ) ) {
-                                    bc = DofLayout_GetValueDouble( rowDofs, rowNodes[n_j], dof_j );
-                                    bcVals[colInd] -= bc * elStiffMat[rowInd][colInd];
-                                }
-                                rowInd++;
-                            }
-                        }
-                    }
-                    colInd++;
+            for( colInd = 0; colInd < nColDofs; colInd++ ) {
+                if( colBCs[colInd] )
+                    continue;
+                for( rowInd = 0; rowInd < nRowDofs; rowInd++ ) {
+                    if( rowBCs[rowInd] )
+                        bcVals[colInd] -= rowBCVals[rowInd] * elStiffMat[rowInd][colInd];
                 }
             }
 
@@ -678,26 +695,17 @@ void __StiffnessMatrix_NewAssemble( void* stiffnessMatrix, void* _sle, void* _co
         }
 
         /* If keeping BCs in, zero corresponding entries in the element stiffness matrix. */
-        if( !rowEqNum->removeBCs || !colEqNum->removeBCs ) {
-            rowInd = 0;
-            for( n_i = 0; n_i < nRowNodes; n_i++ ) {
-                nRowNodeDofs = rowDofs->dofCounts[rowNodes[n_i]];
-                for( dof_i = 0; dof_i < nRowNodeDofs; dof_i++ ) {
-                    if( FeVariable_IsBC( rowVar, rowNodes[n_i], dof_i ) ) {
-                        memset( elStiffMat[rowInd], 0, nColDofs * sizeof(double) );
-                    }
-                    else {
-                        colInd = 0;
-                        for( n_j = 0; n_j < nColNodes; n_j++ ) {
-                            nColNodeDofs = colDofs->dofCounts[colNodes[n_j]];
-                            for( dof_j = 0; dof_j < nColNodeDofs; dof_j++ ) {
-                                if( FeVariable_IsBC( colVar, colNodes[n_j], dof_j ) )
-                                    elStiffMat[rowInd][colInd] = 0.0;
-                                colInd++;
-                            }
-                        }
-                    }
-                    rowInd++;
+        if( keepBCs && (hasRowBCs || hasColBCs) ) {
+            for( rowInd = 0; rowInd < nRowDofs; rowInd++ ) {
+                if( rowBCs[rowInd] ) {
+                    memset( elStiffMat[rowInd], 0, nColDofs * sizeof(double) );
+                    continue;
+                }
+                if( !hasColBCs )
+                    continue;
+                for( colInd = 0; colInd < nColDofs; colInd++ ) {
+                    if( colBCs[colInd] )
+                        elStiffMat[rowInd][colInd] = 0.0;
                 }
             }
         }
@@ -711,6 +719,10 @@ void __StiffnessMatrix_NewAssemble( void* stiffnessMatrix, void* _sle, void* _co
 
     FreeArray( elStiffMat );
     FreeArray( bcVals );
+    FreeArray( rowBCs );
+    FreeArray( rowBCVals );
+    self->elStiffMat = NULL;
+    self->bcVals = NULL;
 
     /* If keeping BCs in and rows and columnns use the same variable, put ones in all BC'd diagonals. */
     if( !colEqNum->removeBCs && rowVar == colVar ) {
@@ -727,20 +739,19 @@ void __StiffnessMatrix_NewAssemble( void* stiffnessMatrix, void* _sle, void* _co
         }
     }
 
-    /* Reassemble the matrix and vectors. */
+    /* Assemble the matrix and vectors in a single pass. All contributions, including the BC
+       diagonals, have been set above, so the stashed off-process values of the matrix and
+       vectors are communicated together rather than in separate rounds. */
     MatAssemblyBegin( matrix, MAT_FINAL_ASSEMBLY );
-    MatAssemblyEnd( matrix, MAT_FINAL_ASSEMBLY );
-    if( vector ) {
+    if( vector )
         VecAssemblyBegin( vector );
-        VecAssemblyEnd( vector );
-    }
-    if( transVector) {
+    if( transVector )
         VecAssemblyBegin( transVector );
-        VecAssemblyEnd( transVector );
-    }
-
-    MatAssemblyBegin( matrix, MAT_FINAL_ASSEMBLY );
     MatAssemblyEnd( matrix, MAT_FINAL_ASSEMBLY );
+    if( vector )
+        VecAssemblyEnd( vector );
+    if( transVector )
+        VecAssemblyEnd( transVector );
 }
 
 /* +++ PRIVATE FUNCTIONS +++ */
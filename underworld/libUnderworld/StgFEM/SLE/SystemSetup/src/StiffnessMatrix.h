@@ -58,6 +58,8 @@
 		Index                                             offDiagonalNonZeroCount;        \
 		int*                                              offDiagonalNonZeroIndices;      \
 		int                                               assembleOnNodes;                \
+		/* incremented by each StiffnessMatrix_Assemble, so operators formed from the matrix can be checked for staleness */ \
+		unsigned                                          assemblyVersion;                \
 												                                                              \
 		double**					elStiffMat;		\
 		double*						bcVals;				\
@@ -43,6 +43,9 @@ Bool StgFEM_Utils_Init( int* argc, char** argv[] ) {
 	Stg_ComponentRegister_Add( componentRegister, MeshParticleLayout_Type, (Name)"0", _MeshParticleLayout_DefaultNew );
 	RegisterParent( MeshParticleLayout_Type,   PerCellParticleLayout_Type );
 
+   Stg_ComponentRegister_Add( componentRegister, MeshRemapper_Type, (Name)"0", _MeshRemapper_DefaultNew );
+   RegisterParent( MeshRemapper_Type, Remesher_Type );
+
    return True;
 }
 
@@ -0,0 +1,317 @@
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*
+**                                                                                  **
+** This file forms part of the Underworld geophysics modelling application.         **
+**                                                                                  **
+** For full license and copyright information, please refer to the LICENSE.md file  **
+** located at the project root, or contact the authors.                             **
+**                                                                                  **
+**~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+#include <mpi.h>
+#include <StGermain/libStGermain/src/StGermain.h>
+#include <StgDomain/libStgDomain/src/StgDomain.h>
+#include <StgFEM/libStgFEM/src/StgFEM.h>
+
+#include "types.h"
+#include "MeshRemapper.h"
+
+#include <assert.h>
+#include <string.h>
+
+/** Textual name of this class */
+const Type MeshRemapper_Type = "MeshRemapper";
+
+MeshRemapper* MeshRemapper_New( Name name, AbstractContext* context, FeMesh* mesh ) {
+   MeshRemapper* self = (MeshRemapper*)_MeshRemapper_DefaultNew( name );
+
+   self->isConstructed = True;
+   _Remesher_Init( self, context, (Mesh*)mesh );
+   _MeshRemapper_Init( self );
+
+   return self;
+}
+
+void* _MeshRemapper_DefaultNew( Name name ) {
+   /* Variables set in this function */
+   SizeT                                              _sizeOfSelf = sizeof(MeshRemapper);
+   Type                                                      type = MeshRemapper_Type;
+   Stg_Class_DeleteFunction*                              _delete = _MeshRemapper_Delete;
+   Stg_Class_PrintFunction*                                _print = _MeshRemapper_Print;
+   Stg_Class_CopyFunction*                                  _copy = NULL;
+   Stg_Component_DefaultConstructorFunction*  _defaultConstructor = _MeshRemapper_DefaultNew;
+   Stg_Component_ConstructFunction*                    _construct = _MeshRemapper_AssignFromXML;
+   Stg_Component_BuildFunction*                            _build = _MeshRemapper_Build;
+   Stg_Component_InitialiseFunction*                  _initialise = _MeshRemapper_Initialise;
+   Stg_Component_ExecuteFunction*                        _execute = _MeshRemapper_Execute;
+   Stg_Component_DestroyFunction*                        _destroy = _MeshRemapper_Destroy;
+   AllocationType                              nameAllocationType = NON_GLOBAL;
+   Remesher_RemeshFunc*                                remeshFunc = _MeshRemapper_Remesh;
+
+   return (void*)_MeshRemapper_New(  MESHREMAPPER_PASSARGS  );
+}
+
+MeshRemapper* _MeshRemapper_New(  MESHREMAPPER_DEFARGS  ) {
+   MeshRemapper* self;
+
+   /* Allocate memory */
+   assert( _sizeOfSelf >= sizeof(MeshRemapper) );
+   self = (MeshRemapper*)_Remesher_New(  REMESHER_PASSARGS  );
+
+   /* General info */
+   self->variableList = Stg_ObjectList_New();
+   self->incArray = IArray_New();
+   self->nbrArray = IArray_New();
+
+   return self;
+}
+
+void _MeshRemapper_Init( void* remapper ) {
+   MeshRemapper* self = (MeshRemapper*)remapper;
+
+   self->nVerts = 0;
+   self->vertices = NULL;
+   self->values = NULL;
+   self->nSeeds = 0;
+   self->seeds = NULL;
+}
+
+void _MeshRemapper_Delete( void* remapper ) {
+   MeshRemapper* self = (MeshRemapper*)remapper;
+
+   MeshRemapper_Destruct( self );
+   Stg_Class_Delete( self->variableList );
+   Stg_Class_Delete( self->incArray );
+   Stg_Class_Delete( self->nbrArray );
+
+   /* Delete parent */
+   _Remesher_Delete( self );
+}
+
+void _MeshRemapper_Print( void* remapper, Stream* stream ) {
+   MeshRemapper* self = (MeshRemapper*)remapper;
+
+   _Remesher_Print( self, stream );
+
+   Journal_PrintPointer( stream, self->mesh );
+   Journal_PrintUnsignedInt( stream, self->variableList->count );
+}
+
+void _MeshRemapper_AssignFromXML( void* remapper, Stg_ComponentFactory* cf, void* data ) {
+   MeshRemapper*           self = (MeshRemapper*)remapper;
+   Dictionary*             dict;
+   Dictionary_Entry_Value* dev;
+   unsigned                field_i;
+   Name                    fieldName;
+   FeVariable*             feVariable;
+
+   _Remesher_AssignFromXML( self, cf, data );
+   _MeshRemapper_Init( self );
+
+   dict = Dictionary_Entry_Value_AsDictionary( Dictionary_Get( cf->componentDict, (Dictionary_Entry_Key)self->name )  );
+   dev  = Dictionary_Get( dict, (Dictionary_Entry_Key)"fields" );
+   for( field_i = 0; field_i < Dictionary_Entry_Value_GetCount( dev ); field_i++ ) {
+      fieldName = Dictionary_Entry_Value_AsString( Dictionary_Entry_Value_GetElement( dev, field_i ) );
+      feVariable = Stg_ComponentFactory_ConstructByName( cf, (Name)fieldName, FeVariable, True, data  );
+      MeshRemapper_AddVariable( self, feVariable );
+   }
+}
+
+void _MeshRemapper_Build( void* remapper, void* data ) {
+   MeshRemapper* self = (MeshRemapper*)remapper;
+   unsigned      field_i;
+
+   _Remesher_Build( self, data );
+   for( field_i = 0; field_i < self->variableList->count; field_i++ )
+      Stg_Component_Build( self->variableList->data[field_i], data, False );
+}
+
+void _MeshRemapper_Initialise( void* remapper, void* data ) {
+   MeshRemapper* self = (MeshRemapper*)remapper;
+   unsigned      field_i;
+
+   _Remesher_Initialise( self, data );
+   for( field_i = 0; field_i < self->variableList->count; field_i++ )
+      Stg_Component_Initialise( self->variableList->data[field_i], data, False );
+}
+
+void _MeshRemapper_Execute( void* remapper, void* data ) {
+}
+
+void _MeshRemapper_Destroy( void* remapper, void* data ) {
+   MeshRemapper* self = (MeshRemapper*)remapper;
+
+   MeshRemapper_Destruct( self );
+}
+
+void _MeshRemapper_Remesh( void* remapper ) {
+   MeshRemapper* self = (MeshRemapper*)remapper;
+   Mesh*         mesh = self->mesh;
+
+   Journal_Firewall( self->vertices != NULL, Mesh_Error,
+                     "Error in %s: MeshRemapper_Interpolate must be called before remeshing.\n", __func__ );
+
+   memcpy( mesh->vertices, self->vertices, self->nVerts * Mesh_GetDimSize( mesh ) * sizeof(double) );
+   Mesh_DeformationUpdate( mesh );
+   MeshRemapper_Apply( self );
+}
+
+/*--------------------------------------------------------------------------------------------------------------------------
+** Public Functions
+*/
+
+void MeshRemapper_AddVariable( void* remapper, FeVariable* feVariable ) {
+   MeshRemapper* self = (MeshRemapper*)remapper;
+
+   assert( self && feVariable );
+   Journal_Firewall( (Mesh*)feVariable->feMesh == self->mesh, Mesh_Error,
+                     "Error in %s: variable '%s' is not defined on the remapped mesh '%s'.\n",
+                     __func__, feVariable->name, self->mesh->name );
+
+   Stg_ObjectList_Append( self->variableList, feVariable );
+}
+
+void MeshRemapper_ClearVariables( void* remapper ) {
+   MeshRemapper* self = (MeshRemapper*)remapper;
+
+   assert( self );
+   while( self->variableList->count )
+      _Stg_ObjectList_RemoveByIndex( self->variableList, self->variableList->count - 1, KEEP );
+}
+
+void MeshRemapper_Interpolate( void* remapper, double* vertices, int nVerts, int nDims ) {
+   MeshRemapper* self = (MeshRemapper*)remapper;
+   FeMesh*       mesh = (FeMesh*)self->mesh;
+   unsigned      nLocals, nComps, nValues;
+   double        xi[3];
+   FeVariable*   feVariable;
+   double*       values;
+   unsigned      el, v_i, var_i;
+
+   assert( self && mesh );
+   Journal_Firewall( nVerts == Mesh_GetDomainSize( mesh, MT_VERTEX ) && nDims == Mesh_GetDimSize( mesh ),
+                     Mesh_Error, "Error in %s: expected %u vertices of %u dimensions, got %d of %d.\n",
+                     __func__, Mesh_GetDomainSize( mesh, MT_VERTEX ), Mesh_GetDimSize( mesh ), nVerts, nDims );
+   Journal_Firewall( Mesh_HasIncidence( mesh, MT_VERTEX, nDims ), Mesh_Error,
+                     "Error in %s: the mesh '%s' has no vertex to element incidence.\n", __func__, mesh->name );
+
+   nLocals = Mesh_GetLocalSize( mesh, MT_VERTEX );
+   nValues = 0;
+   for( var_i = 0; var_i < self->variableList->count; var_i++ ) {
+      feVariable = (FeVariable*)self->variableList->data[var_i];
+      nValues += nLocals * feVariable->fieldComponentCount;
+      /* the halo values are interpolated from too */
+      FeVariable_SyncShadowValues( feVariable );
+   }
+
+   /* element seeds are kept between remaps while the local vertex count is unchanged */
+   if( self->nSeeds != nLocals ) {
+      FreeArray( self->seeds );
+      self->seeds = AllocArray( unsigned, nLocals );
+      self->nSeeds = nLocals;
+      for( v_i = 0; v_i < nLocals; v_i++ )
+         self->seeds[v_i] = (unsigned)-1;
+   }
+   self->nVerts = nVerts;
+   self->vertices = ReallocArray( self->vertices, double, nVerts * nDims );
+   memcpy( self->vertices, vertices, nVerts * nDims * sizeof(double) );
+   self->values = ReallocArray( self->values, double, nValues );
+
+   for( v_i = 0; v_i < nLocals; v_i++ ) {
+      el = MeshRemapper_FindElement( self, v_i, self->vertices + v_i * nDims, xi );
+      self->seeds[v_i] = el;
+
+      values = self->values;
+      for( var_i = 0; var_i < self->variableList->count; var_i++ ) {
+         feVariable = (FeVariable*)self->variableList->data[var_i];
+         nComps = feVariable->fieldComponentCount;
+         FeVariable_InterpolateWithinElement( feVariable, el, xi, values + v_i * nComps );
+         values += nLocals * nComps;
+      }
+   }
+}
+
+void MeshRemapper_Apply( void* remapper ) {
+   MeshRemapper* self = (MeshRemapper*)remapper;
+   unsigned      nLocals, nComps;
+   FeVariable*   feVariable;
+   double*       values;
+   unsigned      v_i, var_i;
+
+   assert( self );
+   Journal_Firewall( self->values != NULL, Mesh_Error,
+                     "Error in %s: MeshRemapper_Interpolate must be called before applying the values.\n", __func__ );
+
+   nLocals = Mesh_GetLocalSize( self->mesh, MT_VERTEX );
+   values = self->values;
+   for( var_i = 0; var_i < self->variableList->count; var_i++ ) {
+      feVariable = (FeVariable*)self->variableList->data[var_i];
+      nComps = feVariable->fieldComponentCount;
+      for( v_i = 0; v_i < nLocals; v_i++ )
+         FeVariable_SetValueAtNode( feVariable, v_i, values + v_i * nComps );
+      FeVariable_SyncShadowValues( feVariable );
+      values += nLocals * nComps;
+   }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------------
+** Private Functions
+*/
+
+unsigned MeshRemapper_FindElement( MeshRemapper* self, unsigned vertex, double* point, double* xi ) {
+   FeMesh*          mesh = (FeMesh*)self->mesh;
+   unsigned         nDims = Mesh_GetDimSize( mesh );
+   MeshTopology_Dim dim;
+   unsigned         seed, el, ind;
+   int              nElVerts, nNbrs;
+   const int        *elVerts, *nbrs;
+   unsigned         v_i, n_i, d_i;
+
+   /* start from the element the vertex was found in last time, or else one of its own. The candidate
+      element is returned, as the point may be reported as lying on one of its faces or vertices. */
+   seed = self->seeds[vertex];
+   if( seed == (unsigned)-1 ) {
+      FeMesh_GetNodeElements( mesh, vertex, self->nbrArray );
+      seed = IArray_GetPtr( self->nbrArray )[0];
+   }
+   if( Mesh_ElementHasPoint( mesh, seed, point, &dim, &ind ) ) {
+      FeMesh_CoordGlobalToLocal( mesh, seed, point, xi );
+      return seed;
+   }
+
+   /* then the elements sharing a vertex with the seed */
+   FeMesh_GetElementNodes( mesh, seed, self->incArray );
+   IArray_GetArray( self->incArray, &nElVerts, &elVerts );
+   for( v_i = 0; v_i < nElVerts; v_i++ ) {
+      FeMesh_GetNodeElements( mesh, elVerts[v_i], self->nbrArray );
+      IArray_GetArray( self->nbrArray, &nNbrs, &nbrs );
+      for( n_i = 0; n_i < nNbrs; n_i++ ) {
+         if( nbrs[n_i] != seed && Mesh_ElementHasPoint( mesh, nbrs[n_i], point, &dim, &ind ) ) {
+            FeMesh_CoordGlobalToLocal( mesh, nbrs[n_i], point, xi );
+            return nbrs[n_i];
+         }
+      }
+   }
+
+   /* then the whole domain */
+   if( Mesh_SearchElements( mesh, point, &el ) ) {
+      FeMesh_CoordGlobalToLocal( mesh, el, point, xi );
+      return el;
+   }
+
+   /* the point has left the domain, so take the closest point of an element of the nearest vertex */
+   FeMesh_GetNodeElements( mesh, Mesh_NearestVertex( mesh, point ), self->nbrArray );
+   el = IArray_GetPtr( self->nbrArray )[0];
+   FeMesh_CoordGlobalToLocal( mesh, el, point, xi );
+   for( d_i = 0; d_i < nDims; d_i++ )
+      xi[d_i] = (xi[d_i] < -1.0) ? -1.0 : ((xi[d_i] > 1.0) ? 1.0 : xi[d_i]);
+
+   return el;
+}
+
+void MeshRemapper_Destruct( MeshRemapper* self ) {
+   KillArray( self->vertices );
+   KillArray( self->values );
+   KillArray( self->seeds );
+   self->nVerts = 0;
+   self->nSeeds = 0;
+}
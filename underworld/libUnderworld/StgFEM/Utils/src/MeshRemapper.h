@@ -0,0 +1,93 @@
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*
+**                                                                                  **
+** This file forms part of the Underworld geophysics modelling application.         **
+**                                                                                  **
+** For full license and copyright information, please refer to the LICENSE.md file  **
+** located at the project root, or contact the authors.                             **
+**                                                                                  **
+**~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+
+#ifndef __StgFEM_Utils_MeshRemapper_h__
+#define __StgFEM_Utils_MeshRemapper_h__
+
+   /** Textual name of this class */
+   extern const Type MeshRemapper_Type;
+
+   /** MeshRemapper class contents. The FeVariables are carried from the current vertex
+       configuration of the mesh to a new one, being interpolated at the new vertex
+       positions on the current geometry. */
+   #define __MeshRemapper \
+      __Remesher \
+      \
+      /* MeshRemapper info */ \
+      Stg_ObjectList*              variableList;      \
+      unsigned                     nVerts;            /* domain vertices in the target configuration */ \
+      double*                      vertices;          /* target vertex coordinates */ \
+      double*                      values;            /* remapped local node values, for each variable in turn */ \
+      unsigned                     nSeeds;            \
+      unsigned*                    seeds;             /* element holding each local vertex at the last remap */ \
+      IArray*                      incArray;          \
+      IArray*                      nbrArray;
+
+   struct MeshRemapper { __MeshRemapper };
+
+   /* --- Constructor functions --- */
+   MeshRemapper* MeshRemapper_New( Name name, AbstractContext* context, FeMesh* mesh );
+
+   void* _MeshRemapper_DefaultNew( Name name );
+
+   #ifndef ZERO
+   #define ZERO 0
+   #endif
+
+   #define MESHREMAPPER_DEFARGS \
+                REMESHER_DEFARGS
+
+   #define MESHREMAPPER_PASSARGS \
+                REMESHER_PASSARGS
+
+   MeshRemapper* _MeshRemapper_New(  MESHREMAPPER_DEFARGS  );
+
+   void _MeshRemapper_Init( void* remapper );
+
+   /* --- Virtual function implementations --- */
+   void _MeshRemapper_Delete( void* remapper );
+   void _MeshRemapper_Print( void* remapper, Stream* stream );
+   void _MeshRemapper_AssignFromXML( void* remapper, Stg_ComponentFactory* cf, void* data );
+   void _MeshRemapper_Build( void* remapper, void* data );
+   void _MeshRemapper_Initialise( void* remapper, void* data );
+   void _MeshRemapper_Execute( void* remapper, void* data );
+   void _MeshRemapper_Destroy( void* remapper, void* data );
+
+   /** Moves the mesh to the target vertices of the last MeshRemapper_Interpolate and applies the
+       remapped values. Submeshes are not regenerated. Collective. */
+   void _MeshRemapper_Remesh( void* remapper );
+
+   /* --- Public functions --- */
+
+   /** Adds a variable to be remapped, which must be defined on the remapper's mesh. */
+   void MeshRemapper_AddVariable( void* remapper, FeVariable* feVariable );
+
+   /** Removes all variables, keeping the element seeds for the next remap. */
+   void MeshRemapper_ClearVariables( void* remapper );
+
+   /** Interpolates each variable at the target positions ('nVerts' domain vertices of 'nDims'
+       coordinates) of the local vertices, on the current geometry of the mesh, keeping the
+       values until MeshRemapper_Apply. Each point is searched for starting from the element
+       it was found in last time (or an element incident on its vertex), then the elements
+       sharing a vertex with that one, before falling back to the mesh's search. Points outside
+       the domain take their value from the element of the closest domain vertex, at the
+       closest point of that element. Collective. */
+   void MeshRemapper_Interpolate( void* remapper, double* vertices, int nVerts, int nDims );
+
+   /** Sets the variables' local node values to those remapped by MeshRemapper_Interpolate,
+       once the mesh has been moved to the target vertices, and synchronises the shadow values.
+       Collective. */
+   void MeshRemapper_Apply( void* remapper );
+
+   /* --- Private functions --- */
+   unsigned MeshRemapper_FindElement( MeshRemapper* self, unsigned vertex, double* point, double* xi );
+   void MeshRemapper_Destruct( MeshRemapper* self );
+
+#endif
@@ -16,6 +16,7 @@
    #include "SemiLagrangianIntegrator.h"
    #include "IrregularMeshParticleLayout.h"
    #include "MeshParticleLayout.h"
+   #include "MeshRemapper.h"
 
    #include "Init.h"
    #include "Finalise.h"
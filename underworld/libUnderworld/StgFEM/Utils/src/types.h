@@ -15,6 +15,7 @@
 	typedef struct SemiLagrangianIntegrator		SemiLagrangianIntegrator;
 	typedef struct IrregularMeshParticleLayout	IrregularMeshParticleLayout;
 	typedef struct MeshParticleLayout		MeshParticleLayout;
+	typedef struct MeshRemapper			MeshRemapper;
 
    /* output streams: initialised in PDE_Rework_Init() */
    extern Stream* StgFEM_Utils_Debug;
@@ -0,0 +1,219 @@
+/*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*
+**                                                                                  **
+** This file forms part of the Underworld geophysics modelling application.         **
+**                                                                                  **
+** For full license and copyright information, please refer to the LICENSE.md file  **
+** located at the project root, or contact the authors.                             **
+**                                                                                  **
+**~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*~*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pcu/pcu.h"
+#include <StGermain/libStGermain/src/StGermain.h>
+#include <StgDomain/libStgDomain/src/StgDomain.h>
+#include <StgFEM/libStgFEM/src/StgFEM.h>
+
+#include "MeshRemapperSuite.h"
+
+#define EPSILON 1.0e-10
+
+typedef struct {
+   FeVariable*   feVar;
+   MeshRemapper* remapper;
+} MeshRemapperSuiteData;
+
+/* linear in both axes, so interpolated exactly by the Q1 elements of an undeformed or row-stretched mesh */
+double MeshRemapperSuite_Field( double* coord ) {
+   return coord[0] + 2.0 * coord[1];
+}
+
+FeVariable* MeshRemapperSuite_BuildFeVariable( unsigned dim ) {
+   CartesianGenerator*     gen;
+   FeMesh*                 feMesh;
+   DofLayout*              dofs;
+   FeEquationNumber*       eqNum;
+   Variable_Register*      varReg;
+   unsigned                maxDecomp[3] = {0, 1, 1};
+   unsigned                sizes[3];
+   double                  minCrd[3];
+   double                  maxCrd[3];
+   static int              arraySize;
+   static double*          arrayPtr;
+   int                     nRanks;
+   StgVariable*            var;
+   FieldVariable_Register* fieldReg;
+   FeVariable*             feVar;
+
+   MPI_Comm_size( MPI_COMM_WORLD, &nRanks );
+   sizes[0] = nRanks * 4;
+   sizes[1] = sizes[2] = 4;
+   minCrd[0] = minCrd[1] = minCrd[2] = 0.0;
+   maxCrd[0] = (double)nRanks;
+   maxCrd[1] = maxCrd[2] = 1.0;
+
+   gen = CartesianGenerator_New( "", NULL );
+   CartesianGenerator_SetDimSize( gen, dim );
+   CartesianGenerator_SetTopologyParams( gen, sizes, 0, NULL, maxDecomp );
+   CartesianGenerator_SetGeometryParams( gen, minCrd, maxCrd );
+   CartesianGenerator_SetShadowDepth( gen, 0 );
+
+   feMesh = FeMesh_New( "" );
+   Mesh_SetGenerator( feMesh, gen );
+   FeMesh_SetElementFamily( feMesh, "Q1" );
+   Stg_Component_Build( feMesh, NULL, False );
+   Stg_Component_Initialise( feMesh, NULL, False );
+
+   varReg = Variable_Register_New();
+
+   arraySize = Mesh_GetDomainSize( feMesh, MT_VERTEX );
+   arrayPtr = Memory_Alloc_Array_Unnamed( double, arraySize );
+
+   var = StgVariable_NewScalar( "phi", NULL, StgVariable_DataType_Double, (Index*)(unsigned*)&arraySize, NULL, (void**)&arrayPtr, varReg );
+   Variable_Register_BuildAll( varReg );
+
+   dofs = DofLayout_New( "", varReg, 0, feMesh );
+   dofs->nBaseVariables = 1;
+   dofs->baseVariables = Memory_Alloc_Array_Unnamed( StgVariable*, 1 );
+   dofs->baseVariables[0] = var;
+   Stg_Component_Build( dofs, NULL, False );
+   Stg_Component_Initialise( dofs, NULL, False );
+
+   eqNum = FeEquationNumber_New( "", NULL, feMesh, dofs, NULL, NULL );
+   Stg_Component_Build( eqNum, NULL, False );
+   Stg_Component_Initialise( eqNum, NULL, False );
+
+   fieldReg = FieldVariable_Register_New();
+   feVar = FeVariable_New( "phi", NULL, feMesh, dofs, NULL, NULL, NULL, dim, False, False, fieldReg );
+
+   Stg_Component_Build( feVar, 0, False );
+   Stg_Component_Initialise( feVar, 0, False );
+
+   return feVar;
+}
+
+void MeshRemapperSuite_SetField( FeVariable* feVar ) {
+   FeMesh*  mesh = feVar->feMesh;
+   double   value;
+   unsigned n_i;
+
+   for( n_i = 0; n_i < Mesh_GetLocalSize( mesh, MT_VERTEX ); n_i++ ) {
+      value = MeshRemapperSuite_Field( Mesh_GetVertex( mesh, n_i ) );
+      FeVariable_SetValueAtNode( feVar, n_i, &value );
+   }
+   FeVariable_SyncShadowValues( feVar );
+}
+
+/* remaps the variable to the given domain vertices and moves the mesh to them */
+void MeshRemapperSuite_Remap( MeshRemapperSuiteData* data, double* vertices ) {
+   FeMesh*  mesh = data->feVar->feMesh;
+   unsigned nDims = Mesh_GetDimSize( mesh );
+   unsigned nVerts = Mesh_GetDomainSize( mesh, MT_VERTEX );
+
+   MeshRemapper_AddVariable( data->remapper, data->feVar );
+   MeshRemapper_Interpolate( data->remapper, vertices, nVerts, nDims );
+   memcpy( mesh->vertices, vertices, nVerts * nDims * sizeof(double) );
+   Mesh_DeformationUpdate( mesh );
+   MeshRemapper_Apply( data->remapper );
+   MeshRemapper_ClearVariables( data->remapper );
+}
+
+void MeshRemapperSuite_Setup( MeshRemapperSuiteData* data ) {
+   Journal_Enable_AllTypedStream( False );
+
+   data->feVar = MeshRemapperSuite_BuildFeVariable( 2 );
+   data->remapper = MeshRemapper_New( "", NULL, data->feVar->feMesh );
+   MeshRemapperSuite_SetField( data->feVar );
+}
+
+void MeshRemapperSuite_Teardown( MeshRemapperSuiteData* data ) {
+   Stg_Class_Delete( data->remapper );
+   Stg_Component_Destroy( data->feVar, NULL, True );
+}
+
+void MeshRemapperSuite_TestInterpolate( MeshRemapperSuiteData* data ) {
+   FeMesh*  mesh = data->feVar->feMesh;
+   unsigned nDims = Mesh_GetDimSize( mesh );
+   unsigned nVerts = Mesh_GetDomainSize( mesh, MT_VERTEX );
+   double*  original;
+   double*  deformed;
+   double*  vert;
+   double   value;
+   unsigned v_i, pass;
+
+   original = Memory_Alloc_Array_Unnamed( double, nVerts * nDims );
+   deformed = Memory_Alloc_Array_Unnamed( double, nVerts * nDims );
+   memcpy( original, mesh->vertices, nVerts * nDims * sizeof(double) );
+
+   /* compress the rows towards the base, which keeps the elements rectangular */
+   memcpy( deformed, original, nVerts * nDims * sizeof(double) );
+   for( v_i = 0; v_i < nVerts; v_i++ )
+      deformed[v_i * nDims + 1] *= 1.0 - 0.1 * deformed[v_i * nDims + 1];
+
+   /* the second pass moves the vertices back, searching from the elements found by the first */
+   for( pass = 0; pass < 2; pass++ ) {
+      MeshRemapperSuite_Remap( data, pass ? original : deformed );
+
+      for( v_i = 0; v_i < Mesh_GetLocalSize( mesh, MT_VERTEX ); v_i++ ) {
+         vert = Mesh_GetVertex( mesh, v_i );
+         FeVariable_GetValueAtNode( data->feVar, v_i, &value );
+         pcu_check_true( fabs( value - MeshRemapperSuite_Field( vert ) ) < EPSILON );
+      }
+   }
+
+   Memory_Free( original );
+   Memory_Free( deformed );
+}
+
+void MeshRemapperSuite_TestFindElement( MeshRemapperSuiteData* data ) {
+   FeMesh*  mesh = data->feVar->feMesh;
+   unsigned nDims = Mesh_GetDimSize( mesh );
+   unsigned nVerts = Mesh_GetDomainSize( mesh, MT_VERTEX );
+   double   inside[2] = { 0.375, 0.6 };
+   double   outside[2] = { -0.25, 0.5 };
+   double   clamped[2] = { 0.0, 0.5 };
+   double   xi[3], value;
+   double*  unmoved;
+   double*  vert;
+   unsigned el, v_i;
+   int      rank;
+
+   /* seed the search by remapping to the unmoved vertices */
+   unmoved = Memory_Alloc_Array_Unnamed( double, nVerts * nDims );
+   memcpy( unmoved, mesh->vertices, nVerts * nDims * sizeof(double) );
+   MeshRemapperSuite_Remap( data, unmoved );
+   Memory_Free( unmoved );
+
+   /* the points are tested from the vertex on the left wall at mid height, held by the first rank */
+   MPI_Comm_rank( MPI_COMM_WORLD, &rank );
+   if( rank != 0 )
+      return;
+   for( v_i = 0; v_i < Mesh_GetLocalSize( mesh, MT_VERTEX ); v_i++ ) {
+      vert = Mesh_GetVertex( mesh, v_i );
+      if( fabs( vert[0] - clamped[0] ) < EPSILON && fabs( vert[1] - clamped[1] ) < EPSILON )
+         break;
+   }
+   pcu_check_true( v_i < Mesh_GetLocalSize( mesh, MT_VERTEX ) );
+
+   /* a point inside the mesh, away from the vertex's own elements */
+   el = MeshRemapper_FindElement( data->remapper, v_i, inside, xi );
+   pcu_check_true( el < Mesh_GetDomainSize( mesh, nDims ) );
+   FeVariable_InterpolateWithinElement( data->feVar, el, xi, &value );
+   pcu_check_true( fabs( value - MeshRemapperSuite_Field( inside ) ) < EPSILON );
+
+   /* a point outside the mesh takes the value at the closest point of the nearest vertex's element */
+   el = MeshRemapper_FindElement( data->remapper, v_i, outside, xi );
+   pcu_check_true( el < Mesh_GetDomainSize( mesh, nDims ) );
+   pcu_check_true( fabs( xi[0] + 1.0 ) < EPSILON );
+   FeVariable_InterpolateWithinElement( data->feVar, el, xi, &value );
+   pcu_check_true( fabs( value - MeshRemapperSuite_Field( clamped ) ) < EPSILON );
+}
+
+
+void MeshRemapperSuite( pcu_suite_t* suite ) {
+   pcu_suite_setData( suite, MeshRemapperSuiteData );
+   pcu_suite_setFixtures( suite, MeshRemapperSuite_Setup, MeshRemapperSuite_Teardown );
+   pcu_suite_addTest( suite, MeshRemapperSuite_TestInterpolate );
+   pcu_suite_addTest( suite, MeshRemapperSuite_TestFindElement );
+}
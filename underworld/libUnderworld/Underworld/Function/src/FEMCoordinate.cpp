@@ -18,7 +18,7 @@ extern "C" {
 #include "FEMCoordinate.hpp"
 
 FEMCoordinate::FEMCoordinate( void* mesh, std::shared_ptr<IO_double> localCoord )
-   : IO_double( _Check_GetDimSize(mesh), FunctionIO::Vector), _localCoord_sp(localCoord), _localCoord(NULL), _mesh(mesh), _index(0), _valueCalculated(false)
+   : IO_double( _Check_GetDimSize(mesh), FunctionIO::Vector), _localCoord_sp(localCoord), _localCoord(NULL), _mesh(mesh), _index(0), _valueCalculated(false), _GNxMesh(NULL), _GNx(NULL)
 {
     if( _localCoord_sp->iotype() != FunctionIO::Vector)
         throw std::invalid_argument("Provided local coordinate must be of 'Vector' type.");
@@ -22,11 +22,16 @@ class FEMCoordinate: public IO_double
         virtual       double& at(std::size_t idx);
         virtual const double  at(std::size_t idx) const;
 
-              unsigned&  index()            { _valueCalculated=false; return _index; };
-        const unsigned   index()      const {                         return _index; };
-              IO_double* localCoord()       { _valueCalculated=false; return _localCoord; };
-        const IO_double* localCoord() const {                         return _localCoord; };
+              unsigned&  index()            { _valueCalculated=false; _GNx=NULL; return _index; };
+        const unsigned   index()      const {                                    return _index; };
+              IO_double* localCoord()       { _valueCalculated=false; _GNx=NULL; return _localCoord; };
+        const IO_double* localCoord() const {                                    return _localCoord; };
         const void* mesh() const {return _mesh;};
+        // Shape function global derivatives at this coordinate for the provided mesh, if already
+        // calculated by the caller (eg. during assembly). They are discarded whenever the coordinate
+        // changes, and functions (such as GradFeVariableFn) may use them to avoid recalculation.
+        void      setGlobalDerivs( void* feMesh, double** GNx ) { _GNxMesh=feMesh; _GNx=GNx; };
+        double**  globalDerivs( const void* feMesh ) const { return (_GNx && feMesh==_GNxMesh) ? _GNx : NULL; };
     private:
         static unsigned _Check_GetDimSize(void* mesh);
         std::shared_ptr<IO_double> _localCoord_sp;
@@ -34,6 +39,8 @@ class FEMCoordinate: public IO_double
         void* _mesh;
         unsigned _index;
         bool mutable _valueCalculated;
+        void* _GNxMesh;
+        double** _GNx;
         void _calculate_value() const;
 };
 
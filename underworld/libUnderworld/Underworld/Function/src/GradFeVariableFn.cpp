@@ -60,7 +60,12 @@ Fn::GradFeVariableFn::func Fn::GradFeVariableFn::getFunction( IOsptr sample_inpu
             return [_output,_output_sp,fevar](IOsptr input)->IOsptr {
                 const FEMCoordinate* femCoord = debug_dynamic_cast<const FEMCoordinate*>(input);
                 
-                FeVariable_InterpolateDerivativesToElLocalCoord( fevar, femCoord->index(), femCoord->localCoord()->data(), _output->data() );
+                // reuse the global derivatives if the caller has already calculated them for our mesh
+                double** GNx = femCoord->globalDerivs( (void*)fevar->feMesh );
+                if( GNx )
+                    FeVariable_InterpolateDerivatives_WithGNx( fevar, femCoord->index(), GNx, _output->data() );
+                else
+                    FeVariable_InterpolateDerivativesToElLocalCoord( fevar, femCoord->index(), femCoord->localCoord()->data(), _output->data() );
 
                 return debug_dynamic_cast<const FunctionIO*>(_output);
             };
@@ -265,7 +265,7 @@ void _ConstitutiveMatrixCartesian_AssembleElement(
    Dof_Index               colNodeDof_I;
    Dof_Index               nodeDofCount;
    double**                Dtilda_B;
-   double                  vel[3], velDerivs[9], *Ni, eta;
+   double                  velDerivs[9], *Ni, eta;
 
    self->sle = sle;
 
@@ -327,13 +327,14 @@ void _ConstitutiveMatrixCartesian_AssembleElement(
          variable1->feMesh, lElement_I,
          particle->xi, dim, &detJac, GNx );
 
-        /* Evalulate velocity and velocity derivatives at this particle. */
-        FeVariable_InterpolateWithinElement(
-           variable1, lElement_I, particle->xi, vel );
-        FeVariable_InterpolateDerivatives_WithGNx(
-           variable1, lElement_I, GNx, velDerivs );
+        /* Velocity derivatives are only required here when forming the Newton Jacobian. Any velocity
+           (or strain rate) dependence of the viscosity is evaluated by the viscosity function itself. */
+        if( sle->nlFormJacobian )
+           FeVariable_InterpolateDerivatives_WithGNx(
+              variable1, lElement_I, GNx, velDerivs );
 
         debug_dynamic_cast<ParticleInCellCoordinate*>(cppdata->input->localCoord())->particle_cellId(cParticle_I);  // set the particleCoord cellId
+        cppdata->input->setGlobalDerivs( variable1->feMesh, GNx );  // share GNx with any GradFeVariableFn in the viscosity graph
 
         /* evaluate function */
         const IO_double* visc1 = debug_dynamic_cast<const IO_double*>(cppdata->func_visc1(cppdata->input.get()));
@@ -426,6 +427,7 @@ void _ConstitutiveMatrixCartesian_AssembleElement(
          }
       }
    }
+   cppdata->input->setGlobalDerivs( NULL, NULL );
 }
 
 void _ConstitutiveMatrixCartesian2D_SetValueInAllEntries( void* constitutiveMatrix, double value ) {
@@ -10,6 +10,7 @@
 #include <mpi.h>
 #include <stdio.h>
 #include <float.h>
+#include <limits.h>
 #include <StGermain/libStGermain/src/StGermain.h>
 #include <StgDomain/libStgDomain/src/StgDomain.h>
 #include <StgFEM/libStgFEM/src/StgFEM.h>
@@ -49,6 +50,8 @@ lucDatabase* _lucDatabase_New(  LUCDATABASE_DEFARGS  )
    self->db        = NULL;
    self->db2       = NULL;
    self->memdb     = NULL;
+   self->geometryInsert   = NULL;
+   self->geometryInsertDb = NULL;
    self->vfs       = NULL;
    self->timeStep  = -1;
 
@@ -87,7 +90,8 @@ void _lucDatabase_Init(
    Bool                 singleFile,
    char*                filename,
    char*                vfs,
-   Bool                 viewonly )
+   Bool                 viewonly,
+   int                  partitions )
 {
    DrawingObject_Index object_I;
 
@@ -143,6 +147,21 @@ void _lucDatabase_Init(
       MPI_Comm_size( self->communicator, &self->nproc );
    }
 
+   /* Geometry is gathered to root by default, if partitions requested each group of procs
+    * gathers to its own root which writes a separate database (requires an output file) */
+   self->partitions = 0;
+   self->partition = 0;
+   self->gatherComm = self->communicator;
+   self->gatherRank = self->rank;
+   self->gatherSize = self->nproc;
+   if (partitions > 1 && self->nproc > 1 && self->filename && strlen(self->filename))
+   {
+      self->partitions = partitions < self->nproc ? partitions : self->nproc;
+      self->partition = self->rank * self->partitions / self->nproc;
+      MPI_Comm_split(self->communicator, self->partition, self->rank, &self->gatherComm);
+      MPI_Comm_rank( self->gatherComm, &self->gatherRank );
+      MPI_Comm_size( self->gatherComm, &self->gatherSize );
+   }
 }
 
 lucDatabase* lucDatabase_New(
@@ -155,7 +174,7 @@ lucDatabase* lucDatabase_New(
    char*             vfs)
 {
    lucDatabase* self = (lucDatabase*)_lucDatabase_DefaultNew("database");
-   _lucDatabase_Init(self, context, NULL, 0, deleteAfter, splitTransactions, compressed, singleFile, filename, vfs, False);
+   _lucDatabase_Init(self, context, NULL, 0, deleteAfter, splitTransactions, compressed, singleFile, filename, vfs, False, 0);
    return self;
 }
 
@@ -172,9 +191,11 @@ void _lucDatabase_Delete( void* database )
    for (type=lucMinType; type<lucMaxType; type++)
       if (self->labels[type]) Memory_Free(self->labels[type]);
 
+   lucDatabase_FinalizeStatements(self);
    if (self->db) sqlite3_close(self->db);
    if (self->db2) sqlite3_close(self->db2);
    if (self->memdb) sqlite3_close(self->memdb);
+   if (self->partitions > 1) MPI_Comm_free(&self->gatherComm);
 
    if (self->filename) Memory_Free(self->filename);
    if (self->vfs) Memory_Free(self->vfs);
@@ -202,7 +223,8 @@ void _lucDatabase_AssignFromXML( void* database, Stg_ComponentFactory* cf, void*
       Stg_ComponentFactory_GetBool( cf, self->name, (Dictionary_Entry_Key)"singleFile", True),
       Stg_ComponentFactory_GetString( cf, self->name, (Dictionary_Entry_Key)"filename", NULL),
       Stg_ComponentFactory_GetString( cf, self->name, (Dictionary_Entry_Key)"vfs", NULL),
-      Stg_ComponentFactory_GetBool( cf, self->name, (Dictionary_Entry_Key)"viewonly", False  )
+      Stg_ComponentFactory_GetBool( cf, self->name, (Dictionary_Entry_Key)"viewonly", False  ),
+      Stg_ComponentFactory_GetInt( cf, self->name, (Dictionary_Entry_Key)"partitions", 0)
       );
 }
 
@@ -231,6 +253,13 @@ void _lucDatabase_Execute( void* database, void* data )
    Index object_I;
    lucDrawingObject* object;
 
+   if (self->rank > 0 && self->gatherRank == 0 && self->partitions > 1)
+   {
+      /* Partition database only holds the geometry of the current timestep */
+      lucDatabase_OpenDatabase(self);
+      lucDatabase_IssueSQL(self->db, "delete from geometry");
+   }
+
    if (self->rank == 0)
    {
       if (!self->db)
@@ -247,6 +276,16 @@ void _lucDatabase_Execute( void* database, void* data )
       }
    }
 
+   /* Object ids are required by partition roots writing geometry */
+   if (self->partitions > 1)
+   {
+      for ( object_I = 0 ; object_I < objectCount ; object_I++ )
+      {
+         object = (lucDrawingObject*)NamedObject_Register_GetByIndex( dr, object_I );
+         MPI_Bcast(&object->id, 1, MPI_INT, 0, self->communicator);
+      }
+   }
+
    /* Call setup on drawing objects (if any) !This must be called on all procs! */
    for ( object_I = 0 ; object_I < objectCount ; object_I++ )
    {
@@ -320,6 +359,10 @@ void _lucDatabase_Execute( void* database, void* data )
       if (object->needsToCleanUp )
          object->_cleanUp( object );
    }
+
+   /* Copy geometry written by other partitions */
+   if (objectCount && self->partitions > 1)
+      lucDatabase_MergePartitions(self);
 }
 
 void _lucDatabase_Destroy( void* database, void* data ) { }
@@ -329,7 +372,7 @@ void lucDatabase_Dump(void* database)
    lucDatabase* self = (lucDatabase*)database;
 
    /* Commit the full timestep transaction */
-   if (!self->splitTransactions)
+   if (!self->splitTransactions && self->rank == 0)
    {
       double wtime = MPI_Wtime();
       lucDatabase_Commit(self);
@@ -437,14 +480,16 @@ void lucDatabase_OutputGeometry(lucDatabase* self, int object_id)
 {
    lucGeometryType type;
    lucGeometryDataType data_type;
-   unsigned int procs = self->nproc;
+   unsigned int procs = self->gatherSize;
    unsigned int bytes = 0, outbytes = 0;
    double time, gtotal = 0, wtotal = 0;
+   /* Partition roots always write each object in its own transaction */
+   Bool transaction = self->gatherRank == 0 && (self->splitTransactions || self->rank > 0);
    //Journal_Printf(lucDebug, "gLucifer: writing geometry to database ...\n");
 
    /* Write geometry to database */
    time = MPI_Wtime();
-   if (self->rank > 0 || !self->splitTransactions || lucDatabase_BeginTransaction(self))
+   if (!transaction || lucDatabase_BeginTransaction(self))
    {
       for (type=lucMinType; type<lucMaxType; type++)
       {
@@ -456,7 +501,7 @@ void lucDatabase_OutputGeometry(lucDatabase* self, int object_id)
                lucDatabase_GatherGeometry(self, type, data_type);
             lucDatabase_GatherLabels(self, type);
          }
-         if (self->rank > 0) continue;
+         if (self->gatherRank > 0) continue;
          gtotal += MPI_Wtime() - time;
 
          /* Loop through all geometry types and write to database */
@@ -470,7 +515,7 @@ void lucDatabase_OutputGeometry(lucDatabase* self, int object_id)
       }
 
       /* Commit transaction */
-      if (self->rank == 0 && self->splitTransactions)
+      if (transaction)
       {
          time = MPI_Wtime();
          lucDatabase_Commit(self);
@@ -480,9 +525,9 @@ void lucDatabase_OutputGeometry(lucDatabase* self, int object_id)
 
    if (bytes > 0)
    {
-      if (self->nproc > 1)
+      if (procs > 1)
          Journal_Printf(lucDebug, "    Gather data, took %f sec\n", gtotal);
-      if (self->rank == 0 && self->splitTransactions)
+      if (transaction)
          Journal_Printf(lucDebug, "    Transaction took %f seconds\n", wtotal);
       Journal_Printf(lucInfo, "    %.3f kb of geometry data saved, %.3f kb written.\n", bytes/1000.0f, outbytes/1000.0f);
    }
@@ -502,78 +547,279 @@ int lucDatabase_GatherCounts(lucDatabase* self, int count, int* counts, int* off
 {
    /* Get the count on each proc */
    int p, total = 0;
-   (void)MPI_Gather(&count, 1, MPI_INT, counts, 1, MPI_INT, 0, self->communicator);
+   (void)MPI_Gather(&count, 1, MPI_INT, counts, 1, MPI_INT, 0, self->gatherComm);
 
    /* Now we have count per proc, calculate offsets and total */
-   if (self->rank == 0)
+   if (self->gatherRank == 0)
    {
-      for (p=0; p<self->nproc; p++) /* Get offset */
+      for (p=0; p<self->gatherSize; p++) /* Get offset */
       {
          offsets[p] = p==0 ? 0 : offsets[p-1] + counts[p-1];
       }
-      total = offsets[self->nproc-1] + counts[self->nproc-1];
+      total = offsets[self->gatherSize-1] + counts[self->gatherSize-1];
       /* All values already on root? no gather required */
       //if (total == count) total = 0;
    }
 
    /* Return total elements to be received */
-   MPI_Bcast(&total, 1, MPI_INT, 0, self->communicator);
+   MPI_Bcast(&total, 1, MPI_INT, 0, self->gatherComm);
    return total;
 }
 
+/*** 
+ * Compresses a segment of a geometry block as raw deflate data, terminated with a sync flush
+ * so that segments from each proc can be concatenated into a single deflate stream on root.
+ *  returns the compressed data, length in cmp_len and adler-32 checksum of the source in adler
+ ***/
+static unsigned char* lucDatabase_DeflateSegment(lucDatabase* self, const unsigned char* src, unsigned long src_len, unsigned long* cmp_len, mz_ulong* adler)
+{
+   mz_stream stream;
+   unsigned long bound = mz_deflateBound(NULL, src_len);
+   unsigned char* cmp_buffer = Memory_Alloc_Array(unsigned char, bound, "DeflateSegment");
+   unsigned long in_len = 0, out_len = 0, chunk;
+   int status = MZ_OK;
+
+   memset(&stream, 0, sizeof(mz_stream));
+   Journal_Firewall(mz_deflateInit2(&stream, 1, MZ_DEFLATED, -MZ_DEFAULT_WINDOW_BITS, 9, MZ_DEFAULT_STRATEGY) == MZ_OK,
+      lucError, "Compress database failed! %s '%s'.\n", self->type, self->name );
+   /* Stream lengths are 32 bit, so feed segments over 4gb through in pieces */
+   while (status == MZ_OK && in_len < src_len)
+   {
+      chunk = src_len - in_len < UINT_MAX ? src_len - in_len : UINT_MAX;
+      stream.next_in = src + in_len;
+      stream.avail_in = chunk;
+      do
+      {
+         stream.next_out = cmp_buffer + out_len;
+         stream.avail_out = bound - out_len < UINT_MAX ? bound - out_len : UINT_MAX;
+         status = mz_deflate(&stream, in_len + chunk < src_len ? MZ_NO_FLUSH : MZ_SYNC_FLUSH);
+         out_len = stream.next_out - cmp_buffer;
+      } while (status == MZ_OK && (stream.avail_in > 0 || stream.avail_out == 0) && out_len < bound);
+      in_len += chunk - stream.avail_in;
+      if (stream.avail_in > 0) break;
+   }
+   Journal_Firewall(status == MZ_OK && in_len == src_len,
+      lucError, "Compress database failed! %s '%s'.\n", self->type, self->name );
+
+   *cmp_len = out_len;
+   *adler = mz_adler32(MZ_ADLER32_INIT, src, src_len);
+   mz_deflateEnd(&stream);
+   return cmp_buffer;
+}
+
+/* Combine adler-32 checksums of two consecutive data segments, as zlib adler32_combine() */
+static mz_ulong lucDatabase_Adler32Combine(mz_ulong adler1, mz_ulong adler2, unsigned long len2)
+{
+   const unsigned long base = 65521;
+   unsigned long rem = len2 % base;
+   unsigned long sum1 = adler1 & 0xffff;
+   unsigned long sum2 = (rem * sum1) % base;
+   sum1 += (adler2 & 0xffff) + base - 1;
+   sum2 += ((adler1 >> 16) & 0xffff) + ((adler2 >> 16) & 0xffff) + base - rem;
+   if (sum1 >= base) sum1 -= base;
+   if (sum1 >= base) sum1 -= base;
+   if (sum2 >= (base << 1)) sum2 -= (base << 1);
+   if (sum2 >= base) sum2 -= base;
+   return sum1 | (sum2 << 16);
+}
+
+/*** 
+ * Gather variable length byte segments on root, segment lengths and offsets on root are 64 bit.
+ * Uses a single Gatherv when the total fits the int counts MPI takes, otherwise each proc
+ * sends its segment to root in pieces of at most INT_MAX bytes.
+ ***/
+static void lucDatabase_GatherBytes(lucDatabase* self, unsigned char* src, unsigned long len, unsigned char* dest, unsigned long total, unsigned long* lengths, unsigned long* offsets)
+{
+   unsigned long sent, chunk;
+   int p;
+
+   if (total <= INT_MAX)
+   {
+      int *counts = NULL, *displs = NULL;
+      if (self->gatherRank == 0)
+      {
+         counts = Memory_Alloc_Array(int, self->gatherSize, "counts");
+         displs = Memory_Alloc_Array(int, self->gatherSize, "displs");
+         for (p=0; p<self->gatherSize; p++)
+         {
+            counts[p] = lengths[p];
+            displs[p] = offsets[p];
+         }
+      }
+      (void)MPI_Gatherv(src, len, MPI_BYTE, dest, counts, displs, MPI_BYTE, 0, self->gatherComm);
+      if (counts) Memory_Free(counts);
+      if (displs) Memory_Free(displs);
+      return;
+   }
+
+   if (self->gatherRank == 0)
+   {
+      if (len > 0) memcpy(dest + offsets[0], src, len);
+      for (p=1; p<self->gatherSize; p++)
+      {
+         for (sent = 0; sent < lengths[p]; sent += chunk)
+         {
+            chunk = lengths[p] - sent < INT_MAX ? lengths[p] - sent : INT_MAX;
+            (void)MPI_Recv(dest + offsets[p] + sent, chunk, MPI_BYTE, p, 0, self->gatherComm, MPI_STATUS_IGNORE);
+         }
+      }
+   }
+   else
+   {
+      for (sent = 0; sent < len; sent += chunk)
+      {
+         chunk = len - sent < INT_MAX ? len - sent : INT_MAX;
+         (void)MPI_Send(src + sent, chunk, MPI_BYTE, 0, 0, self->gatherComm);
+      }
+   }
+}
+
+/*** 
+ * Gather compressed geometry segments from all procs and assemble them on root
+ * into a single zlib stream, identical in format to that written by compress2()
+ * Only used when gathering from more than one proc, serial output is compressed when written
+ *  returns False (on all procs) if compression does not reduce the gathered size
+ ***/
+Bool lucDatabase_GatherCompressed(lucDatabase* self, lucGeometryData* block, int total, int* counts)
+{
+   unsigned long src_len = block->count * sizeof(float);
+   unsigned long cmp_len = 0;
+   unsigned char* cmp_buffer = NULL;
+   mz_ulong adler = MZ_ADLER32_INIT;
+   mz_ulong* adlers = NULL;
+   unsigned long *zcounts = NULL, *zoffsets = NULL;
+   unsigned long ztotal = 0;
+   int p;
+   unsigned char* zdata = NULL;
+
+   if (self->gatherSize < 2) return False;
+
+   if (src_len > 0)
+      cmp_buffer = lucDatabase_DeflateSegment(self, (const unsigned char*)block->data, src_len, &cmp_len, &adler);
+
+   if (self->gatherRank == 0)
+   {
+      zcounts = Memory_Alloc_Array(unsigned long, self->gatherSize, "zcounts");
+      zoffsets = Memory_Alloc_Array(unsigned long, self->gatherSize, "zoffsets");
+      adlers = Memory_Alloc_Array(mz_ulong, self->gatherSize, "adlers");
+   }
+
+   /* Total compressed size is known on all procs, skip if no gain (header + final block + checksum = 8 bytes) */
+   (void)MPI_Gather(&cmp_len, 1, MPI_UNSIGNED_LONG, zcounts, 1, MPI_UNSIGNED_LONG, 0, self->gatherComm);
+   (void)MPI_Allreduce(&cmp_len, &ztotal, 1, MPI_UNSIGNED_LONG, MPI_SUM, self->gatherComm);
+   if (ztotal + 8 >= (unsigned long)total * sizeof(float))
+   {
+      if (cmp_buffer) Memory_Free(cmp_buffer);
+      if (zcounts) Memory_Free(zcounts);
+      if (zoffsets) Memory_Free(zoffsets);
+      if (adlers) Memory_Free(adlers);
+      return False;
+   }
+
+   if (self->gatherRank == 0)
+   {
+      /* Leave room for zlib header (deflate, 32k window, fastest) */
+      zdata = Memory_Alloc_Array(unsigned char, ztotal + 8, "zdata");
+      zdata[0] = 0x78;
+      zdata[1] = 0x01;
+      for (p=0; p<self->gatherSize; p++)
+         zoffsets[p] = p==0 ? 2 : zoffsets[p-1] + zcounts[p-1];
+   }
+
+   (void)MPI_Gather(&adler, 1, MPI_UNSIGNED_LONG, adlers, 1, MPI_UNSIGNED_LONG, 0, self->gatherComm);
+   lucDatabase_GatherBytes(self, cmp_buffer, cmp_len, zdata, ztotal, zcounts, zoffsets);
+
+   if (self->gatherRank == 0)
+   {
+      unsigned char* end = zdata + ztotal + 2;
+      /* Empty final block (fixed huffman, end of block code only), segments are byte aligned by sync flush */
+      *end++ = 0x03;
+      *end++ = 0x00;
+      /* Big-endian adler-32 checksum of the whole block */
+      adler = MZ_ADLER32_INIT;
+      for (p=0; p<self->gatherSize; p++)
+         if (counts[p] > 0) adler = lucDatabase_Adler32Combine(adler, adlers[p], counts[p] * sizeof(float));
+      for (p=0; p<4; p++)
+         *end++ = (adler >> (24 - 8*p)) & 0xff;
+
+      block->zdata = zdata;
+      block->zlength = ztotal + 8;
+      block->count = total;
+   }
+
+   if (cmp_buffer) Memory_Free(cmp_buffer);
+   if (zcounts) Memory_Free(zcounts);
+   if (zoffsets) Memory_Free(zoffsets);
+   if (adlers) Memory_Free(adlers);
+   return True;
+}
+
 void lucDatabase_GatherGeometry(lucDatabase* self, lucGeometryType type, lucGeometryDataType data_type)
 {
    lucGeometryData* block = self->data[type][data_type];
    /* Get the count on each proc */
    int *counts = NULL, *offsets = NULL;
    int p, total = 0;
-   float *data = NULL;
-   if (self->rank == 0)
+   Bool gathered = False;
+   if (self->gatherRank == 0)
    {
-      counts = Memory_Alloc_Array(int, self->nproc, "counts");
-      offsets = Memory_Alloc_Array(int, self->nproc, "offsets");
+      counts = Memory_Alloc_Array(int, self->gatherSize, "counts");
+      offsets = Memory_Alloc_Array(int, self->gatherSize, "offsets");
    }
 
    total = lucDatabase_GatherCounts(self, block->count, counts, offsets);
 
    if (total > 0)
    {
-      if (self->rank == 0)
-         data = Memory_Alloc_Array(float, total, "FloatData");
+      /* Compress on each proc before gathering when enabled and > 1kb, 
+       * so root only receives and writes the compressed stream */
+      if (self->compressed && total * sizeof(float) > 1000)
+         gathered = lucDatabase_GatherCompressed(self, block, total, counts);
 
-      (void)MPI_Gatherv(block->data, block->count, MPI_FLOAT, data, counts, offsets, MPI_FLOAT, 0, self->communicator);
+      if (!gathered)
+      {
+         if (self->gatherRank == 0)
+         {
+            /* Receive directly into the block following the local values,
+             * avoids holding a second full copy of the data on root */
+            if (block->allocated < total)
+            {
+               block->data = Memory_Realloc_Array(block->data, float, total);
+               block->allocated = total;
+            }
+            (void)MPI_Gatherv(MPI_IN_PLACE, 0, MPI_FLOAT, block->data, counts, offsets, MPI_FLOAT, 0, self->gatherComm);
+            block->count = total;
+         }
+         else
+            (void)MPI_Gatherv(block->data, block->count, MPI_FLOAT, NULL, NULL, NULL, MPI_FLOAT, 0, self->gatherComm);
+      }
 
       /* Reduce to get minimum & maximum from all procs */
       float min, max;
       float bmin[3], bmax[3];
       int width = 0;
-      MPI_Reduce( &block->minimum, &min, 1, MPI_FLOAT, MPI_MIN, 0, self->communicator );
-      MPI_Reduce( &block->maximum, &max, 1, MPI_FLOAT, MPI_MAX, 0, self->communicator );
-      MPI_Reduce( block->min, &bmin, 3, MPI_FLOAT, MPI_MIN, 0, self->communicator );
-      MPI_Reduce( block->max, &bmax, 3, MPI_FLOAT, MPI_MAX, 0, self->communicator );
+      MPI_Reduce( &block->minimum, &min, 1, MPI_FLOAT, MPI_MIN, 0, self->gatherComm );
+      MPI_Reduce( &block->maximum, &max, 1, MPI_FLOAT, MPI_MAX, 0, self->gatherComm );
+      MPI_Reduce( block->min, &bmin, 3, MPI_FLOAT, MPI_MIN, 0, self->gatherComm );
+      MPI_Reduce( block->max, &bmax, 3, MPI_FLOAT, MPI_MAX, 0, self->gatherComm );
       memcpy(block->min, bmin, sizeof(float) * 3);
       memcpy(block->max, bmax, sizeof(float) * 3);
       if (data_type == lucVertexData)
-         MPI_Reduce( &block->width, &width, 1, MPI_INT, MPI_SUM, 0, self->communicator );
-      if (self->rank == 0)
+         MPI_Reduce( &block->width, &width, 1, MPI_INT, MPI_SUM, 0, self->gatherComm );
+      if (self->gatherRank == 0)
       {
          //Journal_Printf(lucDebug, "Gathered %d values, took %f sec\n", total, MPI_Wtime() - time);
-         /* Add new data on master */
-         for (p=1; p<self->nproc; p++)
+         for (p=1; p<self->gatherSize; p++)
          {
             if (counts[p] == 0) continue;
-
-            //printf("[%d - %d] Reading %d values at displacement %d from proc %d MIN %f MAX %f WIDTH %d\n", type, data_type, counts[p], offsets[p], p, min, max, width);
             if (data_type == lucVertexData)
                block->width = width;   //Summed width
-            lucGeometryData_Read(block, counts[p] / block->size, &data[offsets[p]]);
          }
          //printf("count %d, \n", block->count);
          lucGeometryData_Setup(block, min, max);
       }
    }
 
-   if (data) Memory_Free(data);
    Memory_Free(counts);
    Memory_Free(offsets);
 }
@@ -585,10 +831,10 @@ void lucDatabase_GatherLabels(lucDatabase* self, lucGeometryType type)
    int *counts = NULL, *offsets = NULL;
    int total = 0;
    char *data = NULL;
-   if (self->rank == 0)
+   if (self->gatherRank == 0)
    {
-      counts = Memory_Alloc_Array(int, self->nproc, "counts");
-      offsets = Memory_Alloc_Array(int, self->nproc, "offsets");
+      counts = Memory_Alloc_Array(int, self->gatherSize, "counts");
+      offsets = Memory_Alloc_Array(int, self->gatherSize, "offsets");
    }
    int length = self->labels[type] ? strlen(self->labels[type])+1 : 0;
    total = lucDatabase_GatherCounts(self, length, counts, offsets);
@@ -596,14 +842,14 @@ void lucDatabase_GatherLabels(lucDatabase* self, lucGeometryType type)
    /* Gather labels */
    if (total > 0)
    {
-      if (self->rank == 0)
+      if (self->gatherRank == 0)
          data = Memory_Alloc_Array(char, total, "LabelData");
 
-      (void)MPI_Gatherv(self->labels[type], length, MPI_CHAR, data, counts, offsets, MPI_CHAR, 0, self->communicator);
-      if (self->rank == 0)
+      (void)MPI_Gatherv(self->labels[type], length, MPI_CHAR, data, counts, offsets, MPI_CHAR, 0, self->gatherComm);
+      if (self->gatherRank == 0)
       {
          /* Add new data on master */
-         for (p=1; p<self->nproc; p++)/* Get displacements */
+         for (p=1; p<self->gatherSize; p++)/* Get displacements */
          {
             if (counts[p] == 0) continue;
             lucDatabase_AddLabel(self, type, &data[offsets[p]]);
@@ -634,6 +880,12 @@ void lucDatabase_AddGridVertex(lucDatabase* self, int width, int height, float*
 }
 
 void lucDatabase_AddVertices(lucDatabase* self, int n, lucGeometryType type, float* data)
+{
+   lucDatabase_VertexBounds(self, n, type, data);
+   lucGeometryData_Read(self->data[type][lucVertexData], n, data);
+}
+
+void lucDatabase_VertexBounds(lucDatabase* self, int n, lucGeometryType type, float* data)
 {
    //Detects bounding box by checking each vertex x,y,z
    float* min = self->data[type][lucVertexData]->min;
@@ -645,8 +897,6 @@ void lucDatabase_AddVertices(lucDatabase* self, int n, lucGeometryType type, flo
       if (data[p] > max[d]) max[d] = data[p];
       if (data[p] < min[d]) min[d] = data[p];
    }
-
-   lucGeometryData_Read(self->data[type][lucVertexData], n, data);
 }
 
 void lucDatabase_AddVerticesWidth(lucDatabase* self, int n, lucGeometryType type, int width, float* data)
@@ -748,6 +998,7 @@ lucGeometryData* lucGeometryData_New(lucGeometryDataType data_type)
    lucGeometryData* self = Memory_Alloc(lucGeometryData, "Geometry data block");
    self->data = NULL;
    self->labels = NULL;
+   self->zdata = NULL;
    self->allocated = 0;
    self->size = 1;
 
@@ -765,6 +1016,10 @@ void lucGeometryData_Clear(lucGeometryData* self)
 {
    self->count = 0;
 
+   if (self->zdata) Memory_Free(self->zdata);
+   self->zdata = NULL;
+   self->zlength = 0;
+
    self->width = 0;
    self->height = 0;
 
@@ -778,6 +1033,7 @@ void lucGeometryData_Clear(lucGeometryData* self)
 void lucGeometryData_Delete(lucGeometryData* self)
 {
    if (self->data) Memory_Free(self->data);
+   if (self->zdata) Memory_Free(self->zdata);
    Memory_Free(self);
 }
 
@@ -799,6 +1055,24 @@ void lucGeometryData_Read(lucGeometryData* self, int items, float* data)
    self->count += new;
 }
 
+float* lucGeometryData_Reserve(lucGeometryData* self, int items)
+{
+   /* Ensure storage for items more values and return the write position,
+    * allows a block to be filled in place then added with lucGeometryData_Extend */
+   int new = items * self->size;
+   if (self->allocated < self->count + new)
+   {
+      self->allocated = self->count + new;
+      self->data = Memory_Realloc_Array(self->data, float, self->allocated);
+   }
+   return self->data + self->count;
+}
+
+void lucGeometryData_Extend(lucGeometryData* self, int items)
+{
+   self->count += items * self->size;
+}
+
 void lucGeometryData_Setup(lucGeometryData* self, float min, float max)
 {
    self->minimum = min;
@@ -817,7 +1091,11 @@ void lucDatabase_OpenDatabase(lucDatabase* self)
 
       if (self->filename && strlen(self->filename))
       {
-         sprintf(self->path, "%s.gldb", self->filename);
+         if (self->rank > 0)
+            /* Geometry partition written by a partition root */
+            sprintf(self->path, "%s.partition%05d.gldb", self->filename, self->partition);
+         else
+            sprintf(self->path, "%s.gldb", self->filename);
       }
       else
       {
@@ -889,18 +1167,42 @@ Bool lucDatabase_IssueSQL(sqlite3* db, const char* SQL)
 
 Bool lucDatabase_BeginTransaction(lucDatabase* self)
 {
-   return lucDatabase_IssueSQL(self->db, "BEGIN EXCLUSIVE TRANSACTION");
+   /* A transaction still open here was left by output that failed before it was committed,
+    * discard the partial timestep rather than failing every following output */
+   if (!sqlite3_get_autocommit(self->db) || (self->db2 && !sqlite3_get_autocommit(self->db2)))
+   {
+      Journal_Printf(lucError, "Discarding incomplete output transaction left open in %s '%s'.\n", self->type, self->name);
+      lucDatabase_Rollback(self);
+   }
+
+   /* Geometry may be written to the per-timestep database, include it in the transaction */
+   if (!lucDatabase_IssueSQL(self->db, "BEGIN EXCLUSIVE TRANSACTION")) return False;
+   if (self->db2 && !lucDatabase_IssueSQL(self->db2, "BEGIN EXCLUSIVE TRANSACTION"))
+   {
+      lucDatabase_IssueSQL(self->db, "ROLLBACK");
+      return False;
+   }
+   return True;
 }
 
 void lucDatabase_Commit(lucDatabase* self)
 {
    lucDatabase_IssueSQL(self->db, "COMMIT");
+   if (self->db2) lucDatabase_IssueSQL(self->db2, "COMMIT");
+}
+
+void lucDatabase_Rollback(lucDatabase* self)
+{
+   /* Only roll back where a transaction is open, rollback outside one is an error */
+   if (self->db && !sqlite3_get_autocommit(self->db)) lucDatabase_IssueSQL(self->db, "ROLLBACK");
+   if (self->db2 && !sqlite3_get_autocommit(self->db2)) lucDatabase_IssueSQL(self->db2, "ROLLBACK");
 }
 
 void lucDatabase_AttachDatabase(lucDatabase* self)
 {
    /* Detach previous */
    char path[256];
+   lucDatabase_FinalizeStatements(self);
    if (self->db2)
       sqlite3_close(self->db2);
 
@@ -917,6 +1219,64 @@ void lucDatabase_AttachDatabase(lucDatabase* self)
    Journal_Printf(lucDebug, "Database file %s opened\n", path);
 }
 
+sqlite3_stmt* lucDatabase_GeometryInsert(lucDatabase* self, sqlite3* db)
+{
+   /* Geometry insert statement is prepared once and reused for every block written to a database */
+   if (self->geometryInsert && self->geometryInsertDb == db)
+      return self->geometryInsert;
+
+   lucDatabase_FinalizeStatements(self);
+   const char* insert = "insert into geometry (object_id, timestep, rank, idx, type, data_type, size, count, width, minimum, maximum, dim_factor, units, minX, minY, minZ, maxX, maxY, maxZ, labels, data) values (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, 1.0, '', ?, ?, ?, ?, ?, ?, ?, ?)";
+   if (sqlite3_prepare_v2(db, insert, -1, &self->geometryInsert, NULL) != SQLITE_OK)
+   {
+      Journal_Printf(lucError, "SQL prepare error: (%s) %s\n", insert, sqlite3_errmsg(db));
+      self->geometryInsert = NULL;
+      return NULL;
+   }
+   self->geometryInsertDb = db;
+   return self->geometryInsert;
+}
+
+void lucDatabase_FinalizeStatements(lucDatabase* self)
+{
+   /* Must be called before closing the database the statements were prepared on */
+   if (self->geometryInsert) sqlite3_finalize(self->geometryInsert);
+   self->geometryInsert = NULL;
+   self->geometryInsertDb = NULL;
+}
+
+void lucDatabase_MergePartitions(lucDatabase* self)
+{
+   /* Attach each partition database in turn and copy its geometry for this timestep,
+    * rows are copied by sqlite so root never holds more than a page of the data */
+   sqlite3* db = self->db;
+   char path[MAX_PATH];
+   int p;
+   double time = MPI_Wtime();
+
+   /* Wait for partition roots to complete their writes */
+   MPI_Barrier(self->communicator);
+   if (self->rank > 0) return;
+
+   if (self->db2) db = self->db2; //Use secondary per-timestep database
+   /* Attach is not permitted within a transaction */
+   if (!self->splitTransactions) lucDatabase_Commit(self);
+
+   for (p=1; p<self->partitions; p++)
+   {
+      snprintf(path, MAX_PATH, "%s.partition%05d.gldb", self->filename, p);
+      snprintf(SQL, MAX_QUERY_LEN, "attach database '%s' as partition", path);
+      if (!lucDatabase_IssueSQL(db, SQL)) continue;
+
+      snprintf(SQL, MAX_QUERY_LEN, "insert into geometry (object_id, timestep, rank, idx, type, data_type, size, count, width, minimum, maximum, dim_factor, units, minX, minY, minZ, maxX, maxY, maxZ, labels, data) select object_id, timestep, rank, idx, type, data_type, size, count, width, minimum, maximum, dim_factor, units, minX, minY, minZ, maxX, maxY, maxZ, labels, data from partition.geometry where timestep=%d", self->timeStep);
+      lucDatabase_IssueSQL(db, SQL);
+      lucDatabase_IssueSQL(db, "detach database partition");
+   }
+
+   if (!self->splitTransactions) lucDatabase_BeginTransaction(self);
+   Journal_Printf(lucDebug, "    Merged %d geometry partitions, took %f sec\n", self->partitions, MPI_Wtime() - time);
+}
+
 void lucDatabase_DeleteGeometry(lucDatabase* self, int start_timestep, int end_timestep)
 {
    if (self->rank > 0) return;
@@ -943,7 +1303,13 @@ int lucDatabase_WriteGeometry(lucDatabase* self, int index, lucGeometryType type
    unsigned long src_len = block->count * sizeof(float);
    unsigned long cmp_len = 0;
    unsigned char* cmp_buffer = NULL;
-   if (self->compressed && src_len > 1000)
+   if (block->zdata)
+   {
+      /* Already compressed on each proc and gathered */
+      src_len = block->zlength;
+      buffer = block->zdata;
+   }
+   else if (self->compressed && src_len > 1000)
    {
       cmp_len = compressBound(src_len);
       cmp_buffer = (unsigned char*)malloc((size_t)cmp_len);
@@ -968,24 +1334,40 @@ int lucDatabase_WriteGeometry(lucDatabase* self, int index, lucGeometryType type
    if (block->min[1] > block->max[1]) block->min[1] = block->max[1] = 0;
    if (block->min[2] > block->max[2]) block->min[2] = block->max[2] = 0;
 
-   snprintf(SQL, MAX_QUERY_LEN, "insert into geometry (object_id, timestep, rank, idx, type, data_type, size, count, width, minimum, maximum, dim_factor, units, minX, minY, minZ, maxX, maxY, maxZ, labels, data) values (%d, %d, %d, %d, %d, %d, %d, %d, %d, %g, %g, %g, '%s', %g, %g, %g, %g, %g, %g, ?, ?)", object_id, self->timeStep, 0, index, type, data_type, block->size, block->count, block->width, block->minimum, block->maximum, 1.0, "", block->min[0], block->min[1], block->min[2], block->max[0], block->max[1], block->max[2]);
+   /* Bind values to the reusable insert statement */
+   statement = lucDatabase_GeometryInsert(self, db);
+   if (!statement) src_len = 0;
 
-   /* Prepare statement... */
-   if (sqlite3_prepare_v2(db, SQL, -1, &statement, NULL) != SQLITE_OK)
+   if (src_len > 0)
    {
-      Journal_Printf(lucError, "SQL prepare error: (%s) %s\n", SQL, sqlite3_errmsg(db));
-      src_len = 0;
+      sqlite3_bind_int(statement, 1, object_id);
+      sqlite3_bind_int(statement, 2, self->timeStep);
+      sqlite3_bind_int(statement, 3, self->partition);
+      sqlite3_bind_int(statement, 4, index);
+      sqlite3_bind_int(statement, 5, type);
+      sqlite3_bind_int(statement, 6, data_type);
+      sqlite3_bind_int(statement, 7, block->size);
+      sqlite3_bind_int(statement, 8, block->count);
+      sqlite3_bind_int(statement, 9, block->width);
+      sqlite3_bind_double(statement, 10, block->minimum);
+      sqlite3_bind_double(statement, 11, block->maximum);
+      sqlite3_bind_double(statement, 12, block->min[0]);
+      sqlite3_bind_double(statement, 13, block->min[1]);
+      sqlite3_bind_double(statement, 14, block->min[2]);
+      sqlite3_bind_double(statement, 15, block->max[0]);
+      sqlite3_bind_double(statement, 16, block->max[1]);
+      sqlite3_bind_double(statement, 17, block->max[2]);
    }
 
    /* Setup text data for insert */
-   if (src_len > 0 && block->labels && sqlite3_bind_text(statement, 1, block->labels, strlen(block->labels), SQLITE_STATIC) != SQLITE_OK)
+   if (src_len > 0 && block->labels && sqlite3_bind_text(statement, 18, block->labels, strlen(block->labels), SQLITE_STATIC) != SQLITE_OK)
    {
       Journal_Printf(lucError, "SQL bind error: %s\n", sqlite3_errmsg(db));
       src_len = 0;
    }
 
    /* Setup blob data for insert */
-   if (src_len > 0 && sqlite3_bind_blob(statement, 2, buffer, src_len, SQLITE_STATIC) != SQLITE_OK)
+   if (src_len > 0 && sqlite3_bind_blob(statement, 19, buffer, src_len, SQLITE_STATIC) != SQLITE_OK)
    {
       Journal_Printf(lucError, "SQL bind error: %s\n", sqlite3_errmsg(db));
       src_len = 0;
@@ -994,11 +1376,16 @@ int lucDatabase_WriteGeometry(lucDatabase* self, int index, lucGeometryType type
    /* Execute statement */
    if (src_len > 0 && sqlite3_step(statement) != SQLITE_DONE )
    {
-      Journal_Printf(lucError, "SQL step error: (%s) %s\n", SQL, sqlite3_errmsg(db));
+      Journal_Printf(lucError, "SQL step error: %s\n", sqlite3_errmsg(db));
       src_len = 0;
    }
 
-   if (src_len > 0) sqlite3_finalize(statement);
+   /* Reset for reuse, clearing bindings as the bound data is not copied */
+   if (statement)
+   {
+      sqlite3_reset(statement);
+      sqlite3_clear_bindings(statement);
+   }
 
    /* Free compression buffer */
    if (cmp_buffer)
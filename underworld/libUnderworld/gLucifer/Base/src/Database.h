@@ -34,6 +34,8 @@ typedef struct
    float min[3];
    float max[3];
    char* labels;     /* Label strings */
+   unsigned char* zdata;   /* Gathered compressed (zlib) data, data/count are not merged when set */
+   unsigned long zlength;
 } lucGeometryData;
 
 extern const Type lucDatabase_Type;
@@ -54,6 +56,8 @@ extern const Type lucDatabase_Type;
       sqlite3*          db;                     \
       sqlite3*          db2;                    \
       sqlite3*          memdb;                  \
+      sqlite3_stmt*     geometryInsert;         \
+      sqlite3*          geometryInsertDb;       \
       char              path[MAX_PATH];         \
       /* Params */ \
       char*             filename;               \
@@ -66,7 +70,13 @@ extern const Type lucDatabase_Type;
       int               rank;                   \
       int               nproc;                  \
       MPI_Comm          communicator;           \
-      int               timeStep;
+      int               timeStep;               \
+      /* Geometry partitions */ \
+      int               partitions;             \
+      int               partition;              \
+      MPI_Comm          gatherComm;             \
+      int               gatherRank;             \
+      int               gatherSize;
 
 struct lucDatabase
 {
@@ -114,6 +124,7 @@ void lucDatabase_OutputColourMap(lucDatabase* self, lucColourMap* colourMap, luc
 void lucDatabase_ClearGeometry(lucDatabase* self);
 void lucDatabase_OutputGeometry(lucDatabase* self, int object_id);
 int lucDatabase_GatherCounts(lucDatabase* self, int count, int* counts, int* offsets);
+Bool lucDatabase_GatherCompressed(lucDatabase* self, lucGeometryData* block, int total, int* counts);
 void lucDatabase_GatherGeometry(lucDatabase* self, lucGeometryType type, lucGeometryDataType data_type);
 void lucDatabase_GatherLabels(lucDatabase* self, lucGeometryType type);
 
@@ -121,6 +132,7 @@ struct lucIsosurface;
 void lucDatabase_AddGridVertices(lucDatabase* self, int n, int width, float* data);
 void lucDatabase_AddGridVertex(lucDatabase* self, int width, int height, float* data);
 void lucDatabase_AddVertices(lucDatabase* self, int n, lucGeometryType type, float* data);
+void lucDatabase_VertexBounds(lucDatabase* self, int n, lucGeometryType type, float* data);
 void lucDatabase_AddVerticesWidth(lucDatabase* self, int n, lucGeometryType type, int width, float* data);
 void lucDatabase_AddNormals(lucDatabase* self, int n, lucGeometryType type, float* data);
 void lucDatabase_AddNormal(lucDatabase* self, lucGeometryType type, XYZ norm);
@@ -136,6 +148,8 @@ lucGeometryData* lucGeometryData_New(lucGeometryDataType data_type);
 void lucGeometryData_Clear(lucGeometryData* self);
 void lucGeometryData_Delete(lucGeometryData* self);
 void lucGeometryData_Read(lucGeometryData* self, int items, float* data); //, int width, int height)
+float* lucGeometryData_Reserve(lucGeometryData* self, int items);
+void lucGeometryData_Extend(lucGeometryData* self, int items);
 void lucGeometryData_Setup(lucGeometryData* self, float min, float max);
 
 void lucDatabase_OpenDatabase(lucDatabase* self);
@@ -143,7 +157,11 @@ void lucDatabase_CreateDatabase(lucDatabase* self);
 Bool lucDatabase_IssueSQL(sqlite3* db, const char* SQL);
 Bool lucDatabase_BeginTransaction(lucDatabase* self);
 void lucDatabase_Commit(lucDatabase* self);
+void lucDatabase_Rollback(lucDatabase* self);
 void lucDatabase_AttachDatabase(lucDatabase* self);
+sqlite3_stmt* lucDatabase_GeometryInsert(lucDatabase* self, sqlite3* db);
+void lucDatabase_FinalizeStatements(lucDatabase* self);
+void lucDatabase_MergePartitions(lucDatabase* self);
 void lucDatabase_DeleteGeometry(lucDatabase* self, int start_timestep, int end_timestep);
 
 int lucDatabase_WriteGeometry(lucDatabase* self, int index, lucGeometryType type, lucGeometryDataType data_type, int object_id, lucGeometryData* block);
@@ -74,6 +74,29 @@ void _lucCrossSection_SetFn( void* _self, Fn::Function* fn ){
         cppdata->fn = std::make_shared<Fn::MinMax>(fn, &sqrtguy);
     cppdata->func = cppdata->fn->getFunction(fIO.get());
 
+    // when sampling a grid, also get the function for element/local coordinate input,
+    // so sample points need only be located in the mesh once while it remains undeformed
+    cppdata->femCoord = NULL;
+    cppdata->femFunc = NULL;
+    cppdata->cache.planes.clear();
+    Mesh* elMesh = self->mesh->parentMesh ? self->mesh->parentMesh : self->mesh;
+    if (!self->onMesh && Stg_Class_IsInstance( elMesh, FeMesh_Type ) && Mesh_GetDomainSize( elMesh, (MeshTopology_Dim)self->dim ) > 0)
+    {
+        try
+        {
+            std::shared_ptr<IO_double> localCoord = std::make_shared<IO_double>( self->dim, FunctionIO::Vector );
+            cppdata->femCoord = std::make_shared<FEMCoordinate>( elMesh, localCoord );
+            cppdata->femCoord->index() = 0;
+            cppdata->femFunc = cppdata->fn->getFunction(cppdata->femCoord.get());
+        }
+        catch (std::exception& e)
+        {
+            // not supported, always sample by global coordinate
+            cppdata->femCoord = NULL;
+            cppdata->femFunc = NULL;
+        }
+    }
+
     if( ( Stg_Class_IsInstance( self, lucScalarField_Type )       ||
           Stg_Class_IsInstance( self, lucFieldSampler_Type ) ||
           Stg_Class_IsInstance( self, lucIsosurfaceCrossSection_Type )          )
@@ -317,6 +340,12 @@ void _lucCrossSection_Destroy( void* drawingObject, void* data ) {}
 void _lucCrossSection_Setup( void* drawingObject, lucDatabase* database, void* _context )
 {
    lucCrossSection* self = (lucCrossSection*)drawingObject;
+   lucCrossSection_cppdata* cppdata = (lucCrossSection_cppdata*) self->cppdata;
+
+   /* New frame, drop located samples of any planes no longer drawn */
+   if (cppdata->plane < cppdata->cache.planes.size())
+      cppdata->cache.planes.resize(cppdata->plane);
+   cppdata->plane = 0;
 
    if (self->onMesh)
    {
@@ -493,17 +522,110 @@ void lucCrossSection_AllocateSampleData(void* drawingObject, int dims)
             self->values[aIndex][bIndex][d] = (d >= self->fieldComponentCount ? 0.0 : HUGE_VAL);
 }
 
+/* Clips the line of samples along B at A factor "factorA" to the (padded) local coord range,
+ * returns False if no samples on the line can be local, otherwise sets first/last B index to sample */
+Bool lucCrossSection_ClipSampleRow(void* crossSection, double factorA, Coord localMin, Coord localMax, Index* bStart, Index* bEnd)
+{
+   lucCrossSection* self = (lucCrossSection*)crossSection;
+   Coord  start, end;
+   double t0 = 0.0, t1 = 1.0;
+   int d;
+
+   /* Position is linear along the row, clip the parameter range against each axis slab */
+   lucCrossSection_Interpolate2d(self, factorA, 0.0, start);
+   lucCrossSection_Interpolate2d(self, factorA, 1.0, end);
+   for (d=0; d<self->dim; d++)
+   {
+      double min = localMin[d] - FLT_EPSILON;
+      double max = localMax[d] + FLT_EPSILON;
+      double delta = end[d] - start[d];
+      if (fabs(delta) < DBL_EPSILON)
+      {
+         if (start[d] < min || start[d] > max) return False;
+         continue;
+      }
+      double ta = (min - start[d]) / delta;
+      double tb = (max - start[d]) / delta;
+      if (ta > tb) { double tmp = ta; ta = tb; tb = tmp; }
+      if (ta > t0) t0 = ta;
+      if (tb < t1) t1 = tb;
+      if (t0 > t1) return False;
+   }
+
+   /* Convert to indices, widened by one sample each side to allow for rounding,
+    * the exact point test is still applied to each sample */
+   double last = (double)(self->resolutionB-1);
+   double startIndex = floor(t0 * last) - 1;
+   double endIndex = ceil(t1 * last) + 1;
+   *bStart = startIndex < 0 ? 0 : (Index)startIndex;
+   *bEnd = endIndex > last ? self->resolutionB-1 : (Index)endIndex;
+   return True;
+}
+
+/* Returns the located samples for the current cross section plane, or a new empty plane to be filled
+ * while sampling if not yet located, or NULL when the function can't be evaluated by element */
+lucCrossSection_SamplePlane* lucCrossSection_GetSamplePlane(lucCrossSection* self, Bool reverse)
+{
+   lucCrossSection_cppdata* cppdata = (lucCrossSection_cppdata*) self->cppdata;
+   if (!cppdata->femFunc) return NULL;
+
+   /* Discard all located samples when the mesh has been deformed */
+   lucCrossSection_SampleCache* cache = &cppdata->cache;
+   Mesh* elMesh = (Mesh*)cppdata->femCoord->mesh();
+   if (cache->meshVersion != elMesh->geometryVersion)
+   {
+      cache->planes.clear();
+      cache->meshVersion = elMesh->geometryVersion;
+   }
+
+   /* Planes are matched by their order of drawing within the frame */
+   unsigned index = cppdata->plane++;
+   if (index < cache->planes.size())
+   {
+      lucCrossSection_SamplePlane* plane = &cache->planes[index];
+      if (plane->resolutionA == self->resolutionA && plane->resolutionB == self->resolutionB && plane->reverse == (bool)reverse &&
+          memcmp(plane->coord1, self->coord1, sizeof(XYZ)) == 0 &&
+          memcmp(plane->coord2, self->coord2, sizeof(XYZ)) == 0 &&
+          memcmp(plane->coord3, self->coord3, sizeof(XYZ)) == 0)
+         return plane;
+      /* Plane has moved, replace it */
+      cache->planes[index] = lucCrossSection_SamplePlane();
+   }
+   else
+      cache->planes.resize(index + 1);
+
+   lucCrossSection_SamplePlane* plane = &cache->planes[index];
+   memcpy(plane->coord1, self->coord1, sizeof(XYZ));
+   memcpy(plane->coord2, self->coord2, sizeof(XYZ));
+   memcpy(plane->coord3, self->coord3, sizeof(XYZ));
+   plane->resolutionA = self->resolutionA;
+   plane->resolutionB = self->resolutionB;
+   plane->reverse = reverse;
+   plane->located = false;
+   return plane;
+}
+
+/* Returns the number of planes with samples held for reuse, at most the planes drawn per frame */
+unsigned lucCrossSection_GetNumCachedPlanes(void* drawingObject)
+{
+   lucCrossSection* self = (lucCrossSection*)drawingObject;
+   lucCrossSection_cppdata* cppdata = (lucCrossSection_cppdata*) self->cppdata;
+   return cppdata->cache.planes.size();
+}
+
 void lucCrossSection_SampleField(void* drawingObject, Bool reverse)
 {
    lucCrossSection* self = (lucCrossSection*)drawingObject;
    Coord          localMin, localMax;
    Coord          pos;
-   Index          aIndex, bIndex;
+   Index          aIndex, bIndex, bStart, bEnd;
    int d;
    int dims = self->fieldComponentCount;
+   int sampled = 0;
 
    Mesh_GetLocalCoordRange(self->mesh, localMin, localMax );
    std::shared_ptr<IO_double> globalCoord = std::make_shared<IO_double>( self->dim, FunctionIO::Vector );
+   double* coord = globalCoord->data();
    lucCrossSection_cppdata* cppdata = (lucCrossSection_cppdata*) self->cppdata;
    // reset max/min
    cppdata->fn->reset();
@@ -511,9 +633,14 @@ void lucCrossSection_SampleField(void* drawingObject, Bool reverse)
    if (!self->vertices)
      lucCrossSection_AllocateSampleData(self, 0);
 
+   /* Samples already located in the mesh are interpolated directly */
+   lucCrossSection_SamplePlane* plane = lucCrossSection_GetSamplePlane(self, reverse);
+   Mesh* elMesh = plane ? (Mesh*)cppdata->femCoord->mesh() : NULL;
+   Bool located = (plane && plane->located) ? True : False;
+
    /* Get mesh cross section vertices and values */
    double time = MPI_Wtime();
-   Journal_Printf(lucInfo, "Sampling (%s) %d x %d...  0%", self->name, self->resolutionA, self->resolutionB);
+   Journal_Printf(lucInfo, "Sampling (%s) %d x %d%s...  0%", self->name, self->resolutionA, self->resolutionB, located ? " (cached)" : "");
    for ( aIndex = 0 ; aIndex < self->resolutionA ; aIndex++ )
    {
       int percent = 100 * (aIndex + 1) / self->resolutionA;
@@ -523,28 +650,62 @@ void lucCrossSection_SampleField(void* drawingObject, Bool reverse)
       /* Reverse order if requested */
       Index aIndex1 = aIndex;
       if (reverse) aIndex1 = self->resolutionA - aIndex - 1;
+      double factorA = aIndex1 / (double)(self->resolutionA-1);
 
-      for ( bIndex = 0 ; bIndex < self->resolutionB ; bIndex++ )
+      /* Copy vertex data */
+      if (self->rank == 0 || !self->gatherData)
+      {
+         for ( bIndex = 0 ; bIndex < self->resolutionB ; bIndex++ )
+         {
+            lucCrossSection_Interpolate2d(self, factorA, bIndex / (double)(self->resolutionB-1), pos);
+            for (d=0; d<3; d++)
+               self->vertices[aIndex][bIndex][d] = (float)pos[d];
+         }
+      }
+
+      if (located) continue;
+
+      /* Only sample the part of this row crossing the local space,
+       * to avoid wasting time attempting to sample points owned elsewhere */
+      /* Avoid by using onMesh sampling when mesh is irregular as searching for points that are not on the processor is costly */
+      if (!lucCrossSection_ClipSampleRow(self, factorA, localMin, localMax, &bStart, &bEnd))
+         continue;
+
+      for ( bIndex = bStart ; bIndex <= bEnd ; bIndex++ )
       {
-         int d;
          /* Get position */
-         lucCrossSection_Interpolate2d(self, aIndex1 / (double)(self->resolutionA-1), bIndex / (double)(self->resolutionB-1), pos);
-         memcpy( globalCoord->data(), pos, self->dim*sizeof(double) );
+         lucCrossSection_Interpolate2d(self, factorA, bIndex / (double)(self->resolutionB-1), pos);
 
-         /* Check cross section is within local space, 
-          * if outside then skip to avoid wasting time attempting to sample */
-         /* Avoid by using onMesh sampling when mesh is irregular as searching for points that are not on the processor is costly */
+         /* Check sample is within local space */
          if (pos[I_AXIS] > localMin[I_AXIS]-FLT_EPSILON && pos[I_AXIS] < localMax[I_AXIS]+FLT_EPSILON &&
              pos[J_AXIS] > localMin[J_AXIS]-FLT_EPSILON && pos[J_AXIS] < localMax[J_AXIS]+FLT_EPSILON &&
              (self->dim < 3 || (pos[K_AXIS] > localMin[K_AXIS]-FLT_EPSILON && pos[K_AXIS] < localMax[K_AXIS]+FLT_EPSILON)))
          {
+            if (plane)
+            {
+               /* Locate and save, evaluated with all other located samples below */
+               unsigned element;
+               if (Mesh_SearchElements(elMesh, pos, &element))
+               {
+                  size_t offset = plane->localCoords.size();
+                  plane->samples.push_back(aIndex * self->resolutionB + bIndex);
+                  plane->elements.push_back(element);
+                  plane->localCoords.resize(offset + self->dim);
+                  FeMesh_CoordGlobalToLocal(elMesh, element, pos, &plane->localCoords[offset]);
+               }
+               continue;
+            }
+
+            memcpy( coord, pos, self->dim*sizeof(double) );
             try
             {
                const FunctionIO* output = debug_dynamic_cast<const FunctionIO*>(cppdata->func(globalCoord.get()));
  
                /* Value found locally, save */
+               float* value = self->values[aIndex][bIndex];
                for (d=0; d<dims; d++)
-                  self->values[aIndex][bIndex][d] = output->at<float>(d);
+                  value[d] = output->at<float>(d);
+               sampled++;
             }
             catch (std::exception& e)
             {
@@ -553,15 +714,37 @@ void lucCrossSection_SampleField(void* drawingObject, Bool reverse)
                /* Flag not found */
             }
          }
+      }
+   }
 
-         /* Copy vertex data */
-         if (self->rank == 0 || !self->gatherData)
-            for (d=0; d<3; d++)
-               self->vertices[aIndex][bIndex][d] = (float)pos[d];
+   if (plane)
+   {
+      /* Interpolate all located samples within their elements, no searching required */
+      FEMCoordinate* femCoord = cppdata->femCoord.get();
+      plane->located = true;
+      for (unsigned i=0; i < plane->samples.size(); i++)
+      {
+         femCoord->index() = plane->elements[i];
+         memcpy( femCoord->localCoord()->data(), &plane->localCoords[i*self->dim], self->dim*sizeof(double) );
+         try
+         {
+            const FunctionIO* output = debug_dynamic_cast<const FunctionIO*>(cppdata->femFunc(femCoord));
+
+            unsigned sample = plane->samples[i];
+            float* value = self->values[sample / self->resolutionB][sample % self->resolutionB];
+            for (d=0; d<dims; d++)
+               value[d] = output->at<float>(d);
+            sampled++;
+         }
+         catch (std::exception& e)
+         {
+            std::cerr << e.what() << std::endl;
+         }
       }
    }
+
    /* Show each proc as it finishes */
-   Journal_Printf(lucInfo, " (%d)", self->rank);
+   Journal_Printf(lucInfo, " (%d: %d)", self->rank, sampled);
    fflush(stdout);
    MPI_Barrier(self->comm); /* Sync here, then time will show accurately how long sampling took on ALL procs */
    Journal_Printf(lucInfo, " -- %f sec.\n", MPI_Wtime() - time);
@@ -571,33 +754,19 @@ void lucCrossSection_SampleField(void* drawingObject, Bool reverse)
     * eg: surfaces, switch this flag off for others (eg: vectors) */
    if (self->gatherData && self->nproc > 1)
    {
+      /* Samples not found locally are flagged with Infinity, so a minimum reduction
+       * merges values from all procs (where found by more than one proc the lowest is kept) */
       int count = self->resolutionA * self->resolutionB * dims;
-      int r;
       time = MPI_Wtime();
-      for (r=1; r < self->nproc; r++)
+      if (self->rank == 0)
       {
-         if (self->rank == r)
-         {
-            /* Send */
-            (void)MPI_Send(&self->values[0][0][0], count, MPI_FLOAT, 0, r, self->comm);
-            Memory_Free(self->values);
-            self->values = NULL;
-         }
-         else if (self->rank == 0)
-         {
-            /* Receive */
-            MPI_Status status;
-            float*** rvalues = Memory_Alloc_3DArray( float, self->resolutionA, self->resolutionB, dims, (char*) "received vertex values");
-            (void)MPI_Recv(&rvalues[0][0][0], count, MPI_FLOAT, r, r, self->comm, &status);
-
-            /* If value provided, copy into final data (duplicates overwritten) */
-            for ( aIndex = 0 ; aIndex < self->resolutionA ; aIndex++ )
-               for ( bIndex = 0 ; bIndex < self->resolutionB ; bIndex++ )
-                  for (d=0; d<dims; d++)
-                     if (rvalues[aIndex][bIndex][d] != HUGE_VAL)
-                        self->values[aIndex][bIndex][d] = rvalues[aIndex][bIndex][d];
-            Memory_Free(rvalues);
-         }
+         (void)MPI_Reduce(MPI_IN_PLACE, &self->values[0][0][0], count, MPI_FLOAT, MPI_MIN, 0, self->comm);
+      }
+      else
+      {
+         (void)MPI_Reduce(&self->values[0][0][0], NULL, count, MPI_FLOAT, MPI_MIN, 0, self->comm);
+         Memory_Free(self->values);
+         self->values = NULL;
       }
       Journal_Printf(lucInfo, " Gather in %f sec.\n", MPI_Wtime() - time);
    }
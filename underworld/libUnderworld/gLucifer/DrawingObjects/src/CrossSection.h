@@ -13,13 +13,40 @@
 
 extern "C++" {
 
+#include <vector>
 #include <Underworld/Function/src/Function.hpp>
 #include <Underworld/Function/src/MinMax.hpp>
+#include <Underworld/Function/src/FEMCoordinate.hpp>
+
+/* Element and local coordinate of each sample found locally on a cross section plane */
+struct lucCrossSection_SamplePlane
+{
+    double coord1[3], coord2[3], coord3[3];
+    unsigned resolutionA, resolutionB;
+    bool reverse;
+    bool located;
+    std::vector<unsigned> samples;    // offset of each sample in values, aIndex * resolutionB + bIndex
+    std::vector<unsigned> elements;   // domain element index
+    std::vector<double> localCoords;  // dim components per sample
+};
+
+/* Located samples of the planes drawn in the last frame, in drawing order, reused until the mesh
+ * is deformed. A plane that moves or changes resolution replaces the one drawn in its place */
+struct lucCrossSection_SampleCache
+{
+    unsigned meshVersion = 0;
+    std::vector<lucCrossSection_SamplePlane> planes;
+};
 
 struct lucCrossSection_cppdata
 {
     Fn::Function::func func;
     std::shared_ptr<Fn::MinMax> fn;
+    // function for element/local coordinate input, where supported
+    std::shared_ptr<FEMCoordinate> femCoord;
+    Fn::Function::func femFunc;
+    lucCrossSection_SampleCache cache;
+    unsigned plane = 0;  // planes sampled so far this frame
 };
 
 void _lucCrossSection_SetFn( void* _self, Fn::Function* fn );
@@ -116,9 +143,11 @@ lucCrossSection* lucCrossSection_Set(void* crossSection, double val, Axis axis,
 lucCrossSection* lucCrossSection_Slice(void* crossSection, double val, Bool interpolate);
 
 void lucCrossSection_AllocateSampleData(void* drawingObject, int dims);
+Bool lucCrossSection_ClipSampleRow(void* crossSection, double factorA, Coord localMin, Coord localMax, Index* bStart, Index* bEnd);
 void lucCrossSection_SampleField(void* drawingObject, Bool reverse);
 void lucCrossSection_SampleMesh( void* drawingObject, Bool reverse);
 void lucCrossSection_FreeSampleData(void* drawingObject);
+unsigned lucCrossSection_GetNumCachedPlanes(void* drawingObject);
 
 #ifdef __cplusplus
 }
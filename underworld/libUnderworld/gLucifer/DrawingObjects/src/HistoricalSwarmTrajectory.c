@@ -179,27 +179,39 @@ void _lucHistoricalSwarmTrajectory_Draw( void* drawingObject, lucDatabase* datab
    Swarm*                        swarm          = self->swarm;
    Particle_Index                lParticle_I;
    GlobalParticle*               particle;
+   int                           count          = swarm->particleLocalCount;
+   float*                        vertices;
+   unsigned int*                 indices;
 
-   /* Loop over all particles and draw lines according to where each one has been */
-   for ( lParticle_I = 0 ; lParticle_I < swarm->particleLocalCount ; lParticle_I++ )
+   if (!database) return;
+
+   /* Only the current position of each particle is exported, tagged with its id,
+    * the viewer joins these with the positions from previous timesteps to draw each trajectory,
+    * so no history is held here and output per timestep is constant */
+   database->data[lucTracerType][lucVertexData]->width = count;
+   vertices = lucGeometryData_Reserve(database->data[lucTracerType][lucVertexData], count);
+   indices = (unsigned int*)lucGeometryData_Reserve(database->data[lucTracerType][lucIndexData], count);
+
+   /* Fill position and id blocks in place */
+   for ( lParticle_I = 0 ; lParticle_I < count ; lParticle_I++ )
    {
       particle = (GlobalParticle*)Swarm_ParticleAt( swarm, lParticle_I );
       unsigned int* particle_id = ExtensionManager_Get( swarm->particleExtensionMgr, particle, self->particleIdExtHandle );
 
       /* Export particle position */
-      if (database)
-      {
-         float coordf[3] = {particle->coord[0], particle->coord[1], particle->coord[2]};
-         lucDatabase_AddVerticesWidth(database, 1, lucTracerType, swarm->particleLocalCount, coordf);
-         lucDatabase_AddIndex(database, lucTracerType, *particle_id);
+      vertices[lParticle_I*3]   = particle->coord[0];
+      vertices[lParticle_I*3+1] = particle->coord[1];
+      vertices[lParticle_I*3+2] = particle->coord[2];
+      indices[lParticle_I] = *particle_id;
 
-         /* Export particle colour value - not required when using same value for every particle at timestep /
-         if (colourMap)
-         {
-            lucDatabase_AddValues(database, 1, lucTracerType, lucColourValueData, colourMap, &value);
-         }*/
-      }
+      /* Export particle colour value - not required when using same value for every particle at timestep /
+      if (colourMap)
+      {
+         lucDatabase_AddValues(database, 1, lucTracerType, lucColourValueData, colourMap, &value);
+      }*/
    }
-}
-
 
+   lucDatabase_VertexBounds(database, count, lucTracerType, vertices);
+   lucGeometryData_Extend(database->data[lucTracerType][lucVertexData], count);
+   lucGeometryData_Extend(database->data[lucTracerType][lucIndexData], count);
+}
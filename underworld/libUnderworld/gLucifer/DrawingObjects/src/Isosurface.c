@@ -55,6 +55,7 @@ void _lucIsosurface_Init(
 
    self->trianglesAlloced = 100;
    self->triangleList = Memory_Alloc_Array( Surface_Triangle, self->trianglesAlloced, "triangleList" );
+   self->vertex = NULL;
 }
 
 void _lucIsosurface_Delete( void* drawingObject )
@@ -62,6 +63,7 @@ void _lucIsosurface_Delete( void* drawingObject )
    lucIsosurface*  self = (lucIsosurface*)drawingObject;
 
    Memory_Free( self->triangleList );
+   if (self->vertex) Memory_Free( self->vertex );
 
    _lucDrawingObject_Delete( self );
 }
@@ -194,10 +196,49 @@ void _lucIsosurface_Setup( void* drawingObject, lucDatabase* database, void* _co
    double max = FieldVariable_GetMaxGlobalFieldMagnitude(self->isosurfaceField);
    if (min == max) return;
    
+   double elapsed = MPI_Wtime();
    if (self->sampleGlobal)
       lucIsosurface_SampleGlobal(drawingObject);
    else
       lucIsosurface_SampleLocal(drawingObject);
+   elapsed = MPI_Wtime() - elapsed;
+   Journal_Printf( lucInfo, "    %u triangles extracted, took %f sec (%.0f triangles/sec)\n", self->triangleCount, elapsed, elapsed > 0 ? self->triangleCount / elapsed : 0.0);
+}
+
+/* Returns the sample grid for the current nx,ny,nz, only reallocated when the size changes */
+Vertex*** lucIsosurface_SampleGrid( lucIsosurface* self )
+{
+   if (!self->vertex || self->vertexDims[0] != self->nx || self->vertexDims[1] != self->ny || self->vertexDims[2] != self->nz)
+   {
+      if (self->vertex) Memory_Free( self->vertex );
+      self->vertex = Memory_Alloc_3DArray( Vertex, self->nx, self->ny, self->nz, (Name)"Vertex array" );
+      self->vertexDims[0] = self->nx;
+      self->vertexDims[1] = self->ny;
+      self->vertexDims[2] = self->nz;
+   }
+   return self->vertex;
+}
+
+/* Tests if the isovalue lies within the range of an element's nodal values,
+ * only valid where shape functions are non-negative (linear elements) so the
+ * interpolated field is bounded by the nodal values */
+Bool lucIsosurface_ElementCrossesIsovalue( lucIsosurface* self, Element_LocalIndex lElement_I, IArray* inc )
+{
+   FeVariable* feVariable = (FeVariable*) self->isosurfaceField;
+   int         nInc, n;
+   int*        nodes;
+   double      value, min = HUGE_VAL, max = -HUGE_VAL;
+
+   FeMesh_GetElementNodes( feVariable->feMesh, lElement_I, inc );
+   nInc = IArray_GetSize( inc );
+   nodes = IArray_GetPtr( inc );
+   for ( n = 0 ; n < nInc ; n++ )
+   {
+      FeVariable_GetValueAtNode( feVariable, nodes[n], &value );
+      if (value < min) min = value;
+      if (value > max) max = value;
+   }
+   return (min <= self->isovalue && max >= self->isovalue);
 }
 
 /* New method: sample & surface each element in local coords, faster, handles deformed meshes */
@@ -209,12 +250,19 @@ void lucIsosurface_SampleLocal( void* drawingObject)
    Element_LocalIndex         lElement_I;
    Element_LocalIndex         elementLocalCount  = FeMesh_GetElementLocalSize( mesh );
    int                        i, j, k;
-   Vertex***                  vertex;
-
-   vertex = Memory_Alloc_3DArray( Vertex, self->nx, self->ny, self->nz, (Name)"Vertex array" );
+   Vertex***                  vertex             = lucIsosurface_SampleGrid( self );
+   IArray*                    inc                = IArray_New();
+   /* Elements that can't contain the isosurface are skipped without sampling, when surfacing only
+    * (walls are drawn over every boundary element) and the field is bounded by its nodal values */
+   Bool                       cull               = self->isosurfaceField->dim == 3 && !self->drawWalls &&
+                                                   self->isosurfaceField->fieldComponentCount == 1 &&
+                                                   Stg_Class_IsInstance( mesh->feElType, TrilinearElementType_Type );
 
    for ( lElement_I = 0 ; lElement_I < elementLocalCount ; lElement_I++ )
    {
+      if (cull && !lucIsosurface_ElementCrossesIsovalue( self, lElement_I, inc ))
+         continue;
+
       for (i = 0 ; i < self->nx; i++)
       {
          for (j = 0 ; j < self->ny; j++)
@@ -243,8 +291,7 @@ void lucIsosurface_SampleLocal( void* drawingObject)
          lucIsosurface_DrawWalls( self, vertex );
    }
 
-   /* Free memory */
-   Memory_Free( vertex );
+   Stg_Class_Delete( inc );
 }
 
 /* Old method: sampling in global coords, slower, assumes regular grid */
@@ -277,7 +324,7 @@ void lucIsosurface_SampleGlobal( void* drawingObject)
       self->nz = 1;
    }
 
-   vertex = Memory_Alloc_3DArray( Vertex , self->nx, self->ny, self->nz , (Name)"Vertex array" );
+   vertex = lucIsosurface_SampleGrid( self );
 
    /* Sample Field in in regular grid */
    for ( i = 0 ; i < self->nx ; i++ )
@@ -305,32 +352,39 @@ void lucIsosurface_SampleGlobal( void* drawingObject)
 
    if (self->isosurfaceField->dim == 2 || self->drawWalls)
       lucIsosurface_DrawWalls( self, vertex );
-
-   /* Free memory */
-   Memory_Free( vertex );
 }
 
 void _lucIsosurface_Write( void* drawingObject, lucDatabase* database, Bool walls )
 {
    /* Export surface triangles */
    lucIsosurface* self = (lucIsosurface*)drawingObject;
-   Index triangle_I;
+   Bool  colour = self->colourField && self->colourMap;
+   Index triangle_I, count = 0;
    int i;
+
+   /* Fill the geometry blocks in place, then add all vertices at once */
+   float* vertices = lucGeometryData_Reserve(database->data[lucTriangleType][lucVertexData], 3 * self->triangleCount);
+   float* values = colour ? lucGeometryData_Reserve(database->data[lucTriangleType][lucColourValueData], 3 * self->triangleCount) : NULL;
    for ( triangle_I = 0 ; triangle_I < self->triangleCount ; triangle_I++)
    {
       if (self->triangleList[triangle_I].wall != walls) continue;
       for (i=0; i<3; i++)
       {
          /* Dump vertex pos, [value] */
-         float coordf[3] = {self->triangleList[triangle_I].pos[i][0],
-                            self->triangleList[triangle_I].pos[i][1],
-                            self->triangleList[triangle_I].pos[i][2]};
-         float value = self->triangleList[triangle_I].value[i];
-         lucDatabase_AddVertices(database, 1, lucTriangleType, coordf);
-         if (self->colourField && self->colourMap)
-            lucDatabase_AddValues(database, 1, lucTriangleType, lucColourValueData, self->colourMap, &value);
+         memcpy(&vertices[3*count], self->triangleList[triangle_I].pos[i], 3 * sizeof(float));
+         if (colour)
+            values[count] = self->triangleList[triangle_I].value[i];
+         count++;
       }
    }
+
+   lucDatabase_VertexBounds(database, count, lucTriangleType, vertices);
+   lucGeometryData_Extend(database->data[lucTriangleType][lucVertexData], count);
+   if (colour)
+   {
+      lucGeometryData_Extend(database->data[lucTriangleType][lucColourValueData], count);
+      lucGeometryData_Setup(database->data[lucTriangleType][lucColourValueData], self->colourMap->minimum, self->colourMap->maximum);
+   }
 }
 
 void _lucIsosurface_Draw( void* drawingObject, lucDatabase* database, void* _context )
@@ -770,7 +824,8 @@ void CreateTriangle(lucIsosurface* self, Vertex* point1, Vertex* point2, Vertex*
 
    if (self->triangleCount >= self->trianglesAlloced)
    {
-      self->trianglesAlloced += 100;
+      /* Grow geometrically, surfaces may have millions of triangles */
+      self->trianglesAlloced *= 2;
       self->triangleList = Memory_Realloc_Array( self->triangleList, Surface_Triangle, self->trianglesAlloced );
    }
 
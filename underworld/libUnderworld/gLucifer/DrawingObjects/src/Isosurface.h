@@ -58,6 +58,9 @@ typedef struct
       Index                               ny;                     \
       Index                               nz;                     \
       Index                               elementRes[3];          \
+      /* Sample grid, reused between draws */ \
+      Vertex***                           vertex;                 \
+      Index                               vertexDims[3];          \
  
 struct lucIsosurface
 {
@@ -94,6 +97,8 @@ void _lucIsosurface_Setup( void* drawingObject, lucDatabase* database, void* _co
 void _lucIsosurface_Write( void* drawingObject, lucDatabase* database, Bool walls );
 void _lucIsosurface_Draw( void* drawingObject, lucDatabase* database, void* _context ) ;
 
+Vertex*** lucIsosurface_SampleGrid( lucIsosurface* self ) ;
+Bool lucIsosurface_ElementCrossesIsovalue( lucIsosurface* self, Element_LocalIndex lElement_I, IArray* inc ) ;
 void lucIsosurface_MarchingCubes( lucIsosurface* self, Vertex*** vertex ) ;
 void lucIsosurface_DrawWalls( lucIsosurface* self, Vertex*** array ) ;
 
@@ -239,29 +239,49 @@ void _lucSwarmViewer_Draw( void* drawingObject, lucDatabase* database, void* _co
    // setup fn_io.
    std::shared_ptr<ParticleCoordinate> particleCoord = std::make_shared<ParticleCoordinate>( self->swarm->particleCoordVariable );
 
+   /* Reserve space for every local particle and fill the geometry blocks in place, evaluating
+    * all functions for each particle in a single pass and compacting out masked particles.
+    * The blocks are then extended once by the surviving count, rather than per particle */
+   float* vertices  = lucGeometryData_Reserve(database->data[self->geomType][lucVertexData], particleLocalCount);
+   float* colours   = cppdata->fn_colour  ? lucGeometryData_Reserve(database->data[self->geomType][lucColourValueData], particleLocalCount) : NULL;
+   float* sizes     = cppdata->fn_size    ? lucGeometryData_Reserve(database->data[self->geomType][lucSizeData], particleLocalCount) : NULL;
+   float* opacities = cppdata->fn_opacity ? lucGeometryData_Reserve(database->data[self->geomType][lucOpacityValueData], particleLocalCount) : NULL;
+   Particle_Index count = 0;
+
    for ( lParticle_I = 0 ; lParticle_I < particleLocalCount ; lParticle_I++)
    {
       particleCoord->index() = lParticle_I;
-      /* note we need to cast object to const version to ensure it selects const data() method */
-      const double* coord = const_cast<const ParticleCoordinate*>(particleCoord.get())->data();
       /* Test to see if this particle should be drawn */
       if ( cppdata->fn_mask && !cppdata->func_mask(particleCoord.get())->at<bool>())
          continue;
 
       /* Export particle position */
-      float coordf[3] = {(float)coord[0],(float) coord[1], swarm->dim == 3 ? (float)coord[2] : 0.0f};
-      lucDatabase_AddVertices(database, 1, self->geomType, coordf);
-
-      if (cppdata->fn_colour) {
-         /* evaluate function */
-         float valuef = cppdata->func_colour(particleCoord.get())->at<float>();
-         lucDatabase_AddValues(database, 1, self->geomType, lucColourValueData, NULL, &valuef);
-      }
-      if (cppdata->fn_size) {
-         /* evaluate function */
-         float valuef = cppdata->func_size(particleCoord.get())->at<float>();
-         lucDatabase_AddValues(database, 1, self->geomType, lucSizeData, NULL, &valuef);
-      }
+      /* note we need to cast object to const version to ensure it selects const data() method */
+      const double* coord = const_cast<const ParticleCoordinate*>(particleCoord.get())->data();
+      vertices[3*count  ] = (float)coord[0];
+      vertices[3*count+1] = (float)coord[1];
+      vertices[3*count+2] = swarm->dim == 3 ? (float)coord[2] : 0.0f;
+
+      /* evaluate functions */
+      if (colours)
+         colours[count] = cppdata->func_colour(particleCoord.get())->at<float>();
+      if (sizes)
+         sizes[count] = cppdata->func_size(particleCoord.get())->at<float>();
+      if (opacities)
+         opacities[count] = cppdata->func_opacity(particleCoord.get())->at<float>();
+      count++;
+   }
+
+   lucDatabase_VertexBounds(database, count, self->geomType, vertices);
+   lucGeometryData_Extend(database->data[self->geomType][lucVertexData], count);
+   if (colours)
+      lucGeometryData_Extend(database->data[self->geomType][lucColourValueData], count);
+   if (sizes)
+      lucGeometryData_Extend(database->data[self->geomType][lucSizeData], count);
+   if (opacities)
+   {
+      lucGeometryData_Extend(database->data[self->geomType][lucOpacityValueData], count);
+      lucGeometryData_Setup(database->data[self->geomType][lucOpacityValueData], cppdata->fn_opacity->getMinGlobal(), cppdata->fn_opacity->getMaxGlobal());
    }
    
    /* Set the value range */
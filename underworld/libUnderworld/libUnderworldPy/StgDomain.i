@@ -28,6 +28,11 @@ extern "C" {
 
 %}
 
+%include "numpy.i"
+%init %{
+import_array();
+%}
+
 #ifndef READ_HDF5
 #define READ_HDF5
 #endif
@@ -38,8 +43,14 @@ extern "C" {
 
 
 %include "StgDomain_Typemaps.i"
+
+%apply (long* IN_ARRAY1, int DIM1) {(long* rows, int rowCount)};
+%apply (int DIM1, int* IN_ARRAY1) {(int nLocals, const int* locals)};
+%apply (int DIM1, int* INPLACE_ARRAY1) {(int nInds, int* inds)};
+
 %include "StgDomain/Geometry/src/types.h"
 %include "StgDomain/Geometry/src/units.h"
+%include "StgDomain/Mesh/src/Decomp.h"
 %include "StgDomain/Mesh/src/MeshClass.h"
 %include "StgDomain/Mesh/src/MeshGenerator.h"
 %include "StgDomain/Mesh/src/CartesianGenerator.h"
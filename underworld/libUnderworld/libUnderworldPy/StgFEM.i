@@ -80,4 +80,6 @@ import_array();
 %include "StgFEM/Utils/src/IrregularMeshParticleLayout.h"
 %include "StgFEM/Utils/src/SemiLagrangianIntegrator.h"
 %include "StgFEM/Utils/src/MeshParticleLayout.h"
+%apply (double* IN_ARRAY2, int DIM1, int DIM2) {(double* vertices, int nVerts, int nDims)};
+%include "StgFEM/Utils/src/MeshRemapper.h"
 %include "StgFEM/Utils/src/types.h"
@@ -73,6 +73,10 @@ class FeMesh(_stgermain.StgCompoundComponent, function.FunctionInput):
 
         self._arr = None
 
+        # created by the first remap, and kept so later remaps may search
+        # from the elements vertices were previously found in
+        self._remapper = None
+
         # build parent
         super(FeMesh,self).__init__(**kwargs)
 
@@ -278,6 +282,67 @@ class FeMesh(_stgermain.StgCompoundComponent, function.FunctionInput):
             for function in self._post_deform_functions:
                 function()
 
+    def remap(self, vertices, variables, isRegular=False):
+        """
+        Moves the mesh vertices to new positions, carrying the values of the
+        given mesh variables across with them. The value at each vertex is
+        interpolated at its new position on the current mesh, so variables are
+        not remapped conservatively, and vertices moved outside the mesh take
+        the value at the closest point of the mesh. The remapping is done in a
+        single pass over all the variables, searching for each new position
+        from the element it was found in previously.
+
+        The mesh is deformed as for `deform_mesh`, so any submesh is updated,
+        though variables on a submesh cannot be remapped.
+
+        Parameters
+        ----------
+        vertices : numpy.ndarray
+            The new positions of the vertices, with the same shape as the
+            mesh's `data` array.
+        variables : list
+            The mesh variables, defined on this mesh, to remap.
+        isRegular : bool
+            As for `deform_mesh`, set to True if the mesh remains regular.
+
+        Notes
+        -----
+        This method must be called collectively by all processes.
+
+        Example
+        -------
+        >>> import underworld as uw
+        >>> import numpy as np
+        >>> someMesh = uw.mesh.FeMesh_Cartesian( elementType='Q1', elementRes=(8,8), minCoord=(0.,0.), maxCoord=(1.,1.) )
+        >>> temperature = someMesh.add_variable( 1 )
+        >>> temperature.data[:,0] = someMesh.data[:,0] + 2.*someMesh.data[:,1]
+        >>> vertices = someMesh.data.copy()
+        >>> vertices[:,1] *= 1. - 0.1*vertices[:,1]
+        >>> someMesh.remap( vertices, [temperature,] )
+        >>> np.allclose( temperature.data[:,0], someMesh.data[:,0] + 2.*someMesh.data[:,1] )
+        True
+        """
+        vertices = np.ascontiguousarray(vertices, dtype=np.float64)
+        if vertices.shape != self.data.shape:
+            raise ValueError("'vertices' must have the shape of the mesh 'data' array, {}.".format(self.data.shape))
+        for var in variables:
+            if not isinstance(var, uw.mesh.MeshVariable) or var.mesh is not self:
+                raise ValueError("Only mesh variables defined on this mesh may be remapped.")
+
+        if self._remapper is None:
+            self._remapper = _stgermain.StgClass( _cself=libUnderworld.StgFEM.MeshRemapper_New( "", None, self._cself ) )
+        remapper = self._remapper._cself
+        try:
+            for var in variables:
+                libUnderworld.StgFEM.MeshRemapper_AddVariable( remapper, var._cself )
+            libUnderworld.StgFEM.MeshRemapper_Interpolate( remapper, vertices )
+            with self.deform_mesh(isRegular=isRegular):
+                self.data[:] = vertices
+            libUnderworld.StgFEM.MeshRemapper_Apply( remapper )
+        finally:
+            # variables are only held for this remap
+            libUnderworld.StgFEM.MeshRemapper_ClearVariables( remapper )
+
     def add_variable(self, nodeDofCount, dataType='double', **kwargs):
         """
         Creates and returns a mesh variable using the discretisation of the given mesh.
@@ -492,7 +557,7 @@ class FeMesh(_stgermain.StgCompoundComponent, function.FunctionInput):
         iset.addAll()
         return iset._get_iterator()
 
-    def save(self, filename, units=None, **kwargs):
+    def save(self, filename, units=None, writer=None, **kwargs):
         """
         Save the mesh to disk
 
@@ -504,6 +569,10 @@ class FeMesh(_stgermain.StgCompoundComponent, function.FunctionInput):
             Define the units that must be used to save the data.
             The data will be dimensionalised and saved with the defined units.
             The units are saved as a HDF attribute.
+        writer : underworld.utils.AsyncWriter (optional)
+            If provided, the mesh is staged and written in the background by
+            the writer, and the file is only complete once the writer is
+            flushed or waited on.
         
         Additional keyword arguments are saved as string attributes.
 
@@ -560,6 +629,30 @@ class FeMesh(_stgermain.StgCompoundComponent, function.FunctionInput):
         if not isinstance(filename, str):
             raise TypeError("'filename', must be of type 'str'")
 
+        if writer is not None:
+            fact = 1.0
+            attrs = {}
+            if units:
+                fact = dimensionalise(1.0, units=units).magnitude
+                attrs['units'] = str(units)
+            attrs['dimensions']      = self.dim
+            attrs['mesh resolution'] = self.elementRes
+            attrs['max']             = tuple([fact*x for x in self.maxCoord])
+            attrs['min']             = tuple([fact*x for x in self.minCoord])
+            attrs['regular']         = self._cself.isRegular
+            attrs['elementType']     = self.elementType
+            for kwarg, val in kwargs.items():
+                attrs[str(kwarg)] = str(val)
+
+            local   = self.nodesLocal
+            elLocal = self.elementsLocal
+            writer.write(filename,
+                         [ ("vertices", (self.nodesGlobal, self.data.shape[1]),
+                            self.data[0:local] * fact, self.data_nodegId[0:local]),
+                           ("en_map", (self.elementsGlobal, self.data_elementNodes.shape[1]),
+                            self.data_elementNodes[0:elLocal], self.data_elgId[0:elLocal]) ],
+                         attrs=attrs)
+            return uw.utils.SavedFileData(self, filename)
 
         with h5File(name=filename, mode="w") as h5f:
             # Save attributes and simple data.
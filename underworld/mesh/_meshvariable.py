@@ -327,7 +327,7 @@ class MeshVariable(_stgermain.StgCompoundComponent,uw.function.Function,_stgerma
             xdmfFH.write(string)
             xdmfFH.close()
 
-    def save( self, filename, meshHandle=None, units=None, **kwargs):
+    def save( self, filename, meshHandle=None, units=None, writer=None, native=False, **kwargs):
         """
         Save the MeshVariable to disk.
 
@@ -346,6 +346,14 @@ class MeshVariable(_stgermain.StgCompoundComponent,uw.function.Function,_stgerma
             The units are saved as a HDF attribute. 
             Note if units are in celsius (see scaling.pint_degc_labels) 
             the data is scaled and save to degrees kelvin. 
+        writer : underworld.utils.AsyncWriter (optional)
+            If provided, the variable is staged and written in the background
+            by the writer, and the file is only complete once the writer is
+            flushed or waited on.
+        native : bool (optional)
+            If True, the values are written collectively using MPI-IO directly
+            from the underlying nodal arrays, to a contiguous dataset aligned to
+            `underworld.utils._io.ALIGNMENT` bytes. Not available with `units`.
 
         Additional keyword arguments are saved as string attributes.
 
@@ -388,6 +396,15 @@ class MeshVariable(_stgermain.StgCompoundComponent,uw.function.Function,_stgerma
         >>> np.allclose(var.data,clone_var.data)
         True
 
+        The variable may also be saved and loaded natively, writing directly
+        from the nodal arrays:
+
+        >>> ignoreMe = var.save("saved_mesh_variable_native.h5", meshHandle, native=True)
+        >>> clone_var.data[:] = 0.
+        >>> clone_var.load("saved_mesh_variable_native.h5", native=True)
+        >>> np.allclose(var.data,clone_var.data)
+        True
+
         Now check the field can be loaded on a different mesh topology (interpolation)
 
         >>> mesh19 = uw.mesh.FeMesh_Cartesian( elementType='Q1/dQ0', elementRes=(19,19), minCoord=(0.,0.), maxCoord=(1.,1.) )
@@ -400,6 +417,7 @@ class MeshVariable(_stgermain.StgCompoundComponent,uw.function.Function,_stgerma
         >>> if uw.mpi.rank == 0:
         ...     import os;
         ...     os.remove( "saved_mesh_variable.h5" )
+        ...     os.remove( "saved_mesh_variable_native.h5" )
         ...     os.remove( "saved_mesh.h5" )
 
         """
@@ -409,6 +427,11 @@ class MeshVariable(_stgermain.StgCompoundComponent,uw.function.Function,_stgerma
             raise TypeError("Expected 'filename' to be provided as a string")
 
         mesh = self.mesh
+        if writer is not None:
+            return self._save_async(filename, meshHandle, units, writer, **kwargs)
+        if native:
+            return self._save_native(filename, meshHandle, units, **kwargs)
+
         with h5File(name=filename, mode="w") as h5f:
 
             # ugly global shape def
@@ -469,7 +492,69 @@ class MeshVariable(_stgermain.StgCompoundComponent,uw.function.Function,_stgerma
         # return our file handle
         return uw.utils.SavedFileData(self, filename)
 
-    def load(self, filename, interpolate=False ):
+    def _save_metadata( self, meshHandle, units, kwargs ):
+        """
+        Returns the file attributes and links written by `save()`.
+        """
+        mesh  = self.mesh
+        attrs = {}
+        for kwarg, val in kwargs.items():
+            attrs[str(kwarg)] = str(val)
+        attrs['units'] = str(units)
+        attrs['elementType'] = np.string_(mesh.elementType)
+
+        links = {}
+        if meshHandle:
+            if not isinstance(meshHandle, (str, uw.utils.SavedFileData)):
+                raise TypeError("Expected 'meshHandle' to be of type 'uw.utils.SavedFileData'")
+            meshFilename = meshHandle.filename
+            if not os.path.exists(meshFilename):
+                raise ValueError("You are trying to link against the mesh file '{}'\n\
+                                  that does not appear to exist. If you need to link \n\
+                                  against a mesh file, please make sure it is created first.".format(meshFilename))
+            links["mesh"] = h5py.ExternalLink(meshFilename, ".")
+        return attrs, links
+
+    def _save_native( self, filename, meshHandle, units, **kwargs):
+        """
+        Writes the variable using the native (C level) writer. The file
+        contents match those written by `save()`.
+        """
+        from ..utils import _io
+
+        if units:
+            raise ValueError("The 'units' parameter is not supported for native saves.")
+        mesh = self.mesh
+        attrs, links = self._save_metadata(meshHandle, None, kwargs)
+        offsets = _io.h5_create_contiguous(filename, [ ("data", (mesh.nodesGlobal, self.data.shape[1]), self.data.dtype) ],
+                                           attrs=attrs, links=links, alignment=_io.ALIGNMENT)
+        libUnderworld.StgFEM.FeVariable_WriteDataset(self._cself, filename, offsets[0])
+        return uw.utils.SavedFileData(self, filename)
+
+    def _save_async( self, filename, meshHandle, units, writer, **kwargs):
+        """
+        Stages the variable for writing by the provided AsyncWriter. The
+        file contents match those written by `save()`.
+        """
+        mesh  = self.mesh
+        local = mesh.nodesLocal
+        if units:
+            xxx = dimensionalise( self.data[0:local], units ).m
+            # if values are celsius then convert to kelvin
+            if units in pint_degc_labels:
+                units = 'degK'
+                xxx = xxx + 273.15
+        else:
+            xxx = self.data[0:local]
+
+        attrs, links = self._save_metadata(meshHandle, units, kwargs)
+
+        writer.write(filename,
+                     [ ("data", (mesh.nodesGlobal, self.data.shape[1]), xxx, mesh.data_nodegId[0:local]) ],
+                     attrs=attrs, links=links)
+        return uw.utils.SavedFileData(self, filename)
+
+    def load(self, filename, interpolate=False, native=False ):
         """
         Load the MeshVariable from disk.
 
@@ -484,6 +569,10 @@ class MeshVariable(_stgermain.StgCompoundComponent,uw.function.Function,_stgerma
             on **each** processor. Also note that the temporary MeshVariable
             can only be built if its corresponding mesh file is available.
             Also note that the supporting mesh mush be regular.
+        native: bool
+            If True, and the file dataset is stored contiguously (as written
+            using the `native` save option), the values are read collectively
+            using MPI-IO directly into the underlying nodal arrays.
 
         Notes
         -----
@@ -518,8 +607,12 @@ class MeshVariable(_stgermain.StgCompoundComponent,uw.function.Function,_stgerma
                 mesh = self.mesh
                 local = mesh.nodesLocal
 
-                with dset.collective:
-                    self.data[0:local] = dset[mesh.data_nodegId[0:local],:]
+                offset = dset.id.get_offset() if native else None
+                if offset is not None and dset.dtype == self.data.dtype:
+                    libUnderworld.StgFEM.FeVariable_ReadDataset(self._cself, filename, offset)
+                else:
+                    with dset.collective:
+                        self.data[0:local] = dset[mesh.data_nodegId[0:local],:]
 
             else:
                 if not interpolate:
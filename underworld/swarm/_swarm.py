@@ -223,7 +223,7 @@ class Swarm(_swarmabstract.SwarmAbstract, function.FunctionInput, _stgermain.Sav
         """
         return libUnderworld.Function.SwarmInput(self._particleCoordinates._cself)
 
-    def save(self, filename, collective=False, units=None, **kwargs):
+    def save(self, filename, collective=False, units=None, writer=None, **kwargs):
         """
         Save the swarm to disk.
 
@@ -240,6 +240,10 @@ class Swarm(_swarmabstract.SwarmAbstract, function.FunctionInput, _stgermain.Sav
             Define the units that must be used to save the data.
             The data will be dimensionalised and saved with the defined units.
             The units are saved as a HDF attribute.
+        writer : underworld.utils.AsyncWriter (optional)
+            If provided, the swarm is staged and written in the background by
+            the writer, and the file is only complete once the writer is
+            flushed or waited on.
 
         Additional keyword arguments are saved as string attributes.
 
@@ -287,7 +291,7 @@ class Swarm(_swarmabstract.SwarmAbstract, function.FunctionInput, _stgermain.Sav
             raise TypeError("Expected filename to be provided as a string")
 
         # just save the particle coordinates SwarmVariable
-        self.particleCoordinates.save(filename, collective, units=units, **kwargs)
+        self.particleCoordinates.save(filename, collective, units=units, writer=writer, **kwargs)
 
         return uw.utils.SavedFileData( self, filename )
 
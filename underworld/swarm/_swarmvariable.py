@@ -241,7 +241,7 @@ class SwarmVariable(_stgermain.StgClass, function.Function):
         self._arr = None
         self._arrshadow = None
 
-    def load( self, filename, collective=False ):
+    def load( self, filename, collective=False, native=False ):
         """
         Load the swarm variable from disk. This must be called *after* the swarm.load().
 
@@ -254,6 +254,10 @@ class SwarmVariable(_stgermain.StgClass, function.Function):
             If True, variable is loaded MPI collective. This is usually faster, but
             currently is problematic for passive swarms which may not have
             representation on all processes.
+        native : bool
+            If True, and the file dataset is stored contiguously (as written
+            using the `native` save option), the values are read collectively
+            using MPI-IO directly into the particle arrays.
 
         Notes
         -----
@@ -291,52 +295,57 @@ class SwarmVariable(_stgermain.StgClass, function.Function):
                                    "both the Swarm and the SwarmVariable were saved at the same time, and that you have reloaded using " \
                                    "the correct files.".format(globalCount, dset.shape[0]))
 
-            # for efficiency, we want to load swarmvariable data in the largest stride chunks possible.
-            # we need to determine where required data is contiguous.
-            # first construct an array of gradients. the required data is contiguous
-            # where the indices into the array are increasing by 1, ie have a gradient of 1.
-            gradIds = np.zeros_like(gIds)            # creates array of zeros of same size & type
-            if len(gIds) > 1:
-                gradIds[:-1] = gIds[1:] - gIds[:-1]  # forward difference type gradient
-
-            # note that we do only the first read into dset collective. this call usually
-            # does the entire read, but if it doesn't we won't know how many calls will
-            # be necessary, hence only collective calling the first.
-            done_collective = False
-            guy = 0
-            while guy < len(gIds):
-                # do contiguous
-                start_guy = guy
-                while gradIds[guy]==1:  # count run of contiguous. note bounds check not required as last element of gradIds is always zero.
-                    guy += 1
-                # copy contiguous chunk if found.. note that we are copying 'plus 1' items
-                if guy > start_guy:
-                    if collective and not done_collective:
-                        with dset.collective:
+            offset = dset.id.get_offset() if native else None
+            if offset is not None and dset.dtype == self.data.dtype:
+                libUnderworld.StgDomain.SwarmVariable_ReadDataset(self._cself, filename, offset,
+                                                                  np.ascontiguousarray(gIds, dtype='l'))
+            else:
+                # for efficiency, we want to load swarmvariable data in the largest stride chunks possible.
+                # we need to determine where required data is contiguous.
+                # first construct an array of gradients. the required data is contiguous
+                # where the indices into the array are increasing by 1, ie have a gradient of 1.
+                gradIds = np.zeros_like(gIds)            # creates array of zeros of same size & type
+                if len(gIds) > 1:
+                    gradIds[:-1] = gIds[1:] - gIds[:-1]  # forward difference type gradient
+
+                # note that we do only the first read into dset collective. this call usually
+                # does the entire read, but if it doesn't we won't know how many calls will
+                # be necessary, hence only collective calling the first.
+                done_collective = False
+                guy = 0
+                while guy < len(gIds):
+                    # do contiguous
+                    start_guy = guy
+                    while gradIds[guy]==1:  # count run of contiguous. note bounds check not required as last element of gradIds is always zero.
+                        guy += 1
+                    # copy contiguous chunk if found.. note that we are copying 'plus 1' items
+                    if guy > start_guy:
+                        if collective and not done_collective:
+                            with dset.collective:
+                                self.data[start_guy:guy+1] = dset[gIds[start_guy]:gIds[guy]+1]
+                                done_collective = True
+                        else:
                             self.data[start_guy:guy+1] = dset[gIds[start_guy]:gIds[guy]+1]
-                            done_collective = True
-                    else:
-                        self.data[start_guy:guy+1] = dset[gIds[start_guy]:gIds[guy]+1]
-                    guy += 1
-
-                # do non-contiguous
-                start_guy = guy
-                while guy<len(gIds) and gradIds[guy]!=1:  # count run of non-contiguous
-                    guy += 1
-                # copy non-contiguous items (if found) using index array slice
-                if guy > start_guy:
-                    if collective and not done_collective:
-                        with dset.collective:
+                        guy += 1
+
+                    # do non-contiguous
+                    start_guy = guy
+                    while guy<len(gIds) and gradIds[guy]!=1:  # count run of non-contiguous
+                        guy += 1
+                    # copy non-contiguous items (if found) using index array slice
+                    if guy > start_guy:
+                        if collective and not done_collective:
+                            with dset.collective:
+                                self.data[start_guy:guy,:] = dset[gIds[start_guy:guy],:]
+                                done_collective = True
+                        else:
                             self.data[start_guy:guy,:] = dset[gIds[start_guy:guy],:]
-                            done_collective = True
-                    else:
-                        self.data[start_guy:guy,:] = dset[gIds[start_guy:guy],:]
 
-            # if we haven't entered a collective call, do so now to
-            # avoid deadlock. we just do an empty read/write.
-            if collective and not done_collective:
-                with dset.collective:
-                    self.data[0:0,:] = dset[0:0,:]
+                # if we haven't entered a collective call, do so now to
+                # avoid deadlock. we just do an empty read/write.
+                if collective and not done_collective:
+                    with dset.collective:
+                        self.data[0:0,:] = dset[0:0,:]
 
             try:
                 iunits = u.Quantity(h5f.attrs['units'])
@@ -359,7 +368,7 @@ class SwarmVariable(_stgermain.StgClass, function.Function):
             else:
                 self.data[:] = non_dimensionalise(self.data * iunits)
 
-    def save( self, filename, collective=False, swarmHandle=None, units=None, **kwargs):
+    def save( self, filename, collective=False, swarmHandle=None, units=None, writer=None, native=False, **kwargs):
         """
         Save the swarm variable to disk.
 
@@ -379,6 +388,15 @@ class SwarmVariable(_stgermain.StgClass, function.Function):
             Define the units that must be used to save the data.
             The data will be dimensionalise and saved with the defined units.
             The units are saved as a HDF attribute.
+        writer : underworld.utils.AsyncWriter (optional)
+            If provided, the variable is staged and written in the background
+            by the writer, and the file is only complete once the writer is
+            flushed or waited on. Writes are always independent (non
+            collective) in this case.
+        native : bool
+            If True, the values are written collectively using MPI-IO directly
+            from the particle arrays, to a contiguous dataset aligned to
+            `underworld.utils._io.ALIGNMENT` bytes. Not available with `units`.
 
         Additional keyword arguments are saved as string attributes.
 
@@ -425,11 +443,21 @@ class SwarmVariable(_stgermain.StgClass, function.Function):
         >>> np.allclose(svar.data,clone_svar.data)
         True
 
+        The variable may also be saved and loaded natively, writing directly
+        from the particle arrays:
+
+        >>> ignoreMe = svar.save("saved_swarm_variable_native.h5", native=True)
+        >>> clone_svar.data[:] = 0
+        >>> clone_svar.load("saved_swarm_variable_native.h5", native=True)
+        >>> np.allclose(svar.data,clone_svar.data)
+        True
+
         >>> # clean up:
         >>> if uw.mpi.rank == 0:
         ...     import os;
         ...     os.remove( "saved_swarm.h5" )
         ...     os.remove( "saved_swarm_variable.h5" )
+        ...     os.remove( "saved_swarm_variable_native.h5" )
 
         """
         from ..utils._io import h5File, h5_require_dataset
@@ -451,6 +479,46 @@ class SwarmVariable(_stgermain.StgClass, function.Function):
         for i in range(comm.rank):
             offset += procCount[i]
 
+        if writer is not None or native:
+            if native and units:
+                raise ValueError("The 'units' parameter is not supported for native saves.")
+            if units:
+                xxx = dimensionalise( self.data[:], units=units ).m
+                # if save in celsius then -273.15
+                if units in pint_degc_labels:
+                    xxx = xxx - 273.15
+            else:
+                xxx = self.data[:]
+
+            links = {}
+            if swarmHandle is not None:
+                if not isinstance(swarmHandle, (str, uw.utils.SavedFileData)):
+                    raise TypeError("Expected 'swarmHandle' to be of type 'uw.utils.SavedFileData'")
+                sFilename = swarmHandle.filename
+                if not os.path.exists(sFilename):
+                    raise ValueError("You are trying to link against the swarm file '{}'\n\
+                                      that does not appear to exist.".format(sFilename))
+                links["swarm"] = h5py.ExternalLink(sFilename, "./")
+
+            attrs = {}
+            attrs["proc_offset"] = procCount
+            attrs["units"] = str(units)
+            for kwarg, val in kwargs.items():
+                attrs[str(kwarg)] = str(val)
+
+            if native:
+                from ..utils import _io
+                offsets = _io.h5_create_contiguous(filename, [ ("data", (particleGlobalCount, self.data.shape[1]), self.data.dtype) ],
+                                                   attrs=attrs, links=links, alignment=_io.ALIGNMENT)
+                if offsets[0] is not None:
+                    libUnderworld.StgDomain.SwarmVariable_WriteDataset(self._cself, filename, offsets[0])
+                return uw.utils.SavedFileData( self, filename )
+
+            writer.write(filename,
+                         [ ("data", (particleGlobalCount, self.data.shape[1]), xxx, offset) ],
+                         attrs=attrs, links=links)
+            return uw.utils.SavedFileData( self, filename )
+
         with h5File(name=filename, mode="w") as h5f:
             # write the entire local swarm to the appropriate offset position
             globalShape = (particleGlobalCount, self.data.shape[1])
@@ -263,8 +263,11 @@ class _SLCN_AdvectionDiffusion(object):
         self._maxVsq  = uw.function.view.min_max(velocityField, fn_norm = uw.function.math.dot(velocityField, velocityField) )
         self._maxDiff = uw.function.view.min_max(self.fn_diffusivity)
 
-        # Note that the c level minSep on the mesh is for the local domain
-        sepFn = uw.function.misc.constant( velocityField.mesh._cself.minSep)
+        # Note that the c level minSep on the mesh is for the local domain,
+        # and is only computed when asked for
+        minSep = uw.libUnderworld.c_arrays.DoubleArray(1)
+        uw.libUnderworld.StgDomain.Mesh_GetMinimumSeparation( velocityField.mesh._cself, minSep.cast(), None )
+        sepFn = uw.function.misc.constant( minSep[0] )
         minmaxSep  = uw.function.view.min_max(sepFn)
         minmaxSep.evaluate(mesh)
 
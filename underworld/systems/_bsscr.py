@@ -145,6 +145,8 @@ class OptionsMain(Options):
     """
     penalty = 0                                       : Penalty number for Augmented Lagrangian
     Q22_pc_type = <"uw","uwscale", "gkgdiag", "bfbt"> : Schur preconditioner operators
+    Q22_pc_reuse = <True,False>                       : Keep the Schur preconditioner until the mesh geometry (or, with rescale_equations, K) changes
+    Q22_pc_reuse_its_factor = 1.5                     : Also rebuild uwscale/gkgdiag once pressure iterations grow by this factor
     force_correction = <True,False>                   : Correct force term for Augmented Lagrangian
     rescale_equations = <True,False>                  : Use scaling on matrices
     k_scale_only = <True,False>                       : Only scale Velocity matrix
@@ -158,6 +160,8 @@ class OptionsMain(Options):
         Reset values to initial defaults.
         """
         self.Q22_pc_type = "uw"
+        self.Q22_pc_reuse = False
+        self.Q22_pc_reuse_its_factor = 1.5
         self.force_correction = True
         self.ksp_type = "bsscr"
         self.pc_type = "none"
@@ -758,6 +762,11 @@ class StokesSolver(_stgermain.StgCompoundComponent):
             print( "Velocity solve time: %.4e (backsolve)" %(self._cself.stats.velocity_backsolve_time) )
             print( "Total solve time   : %.4e" %(self._cself.stats.total_time) )
             print( " " )
+            if self.options.main.Q22_pc_reuse:
+                print( "Schur pc rebuilds/reuses: %d/%d" % (self._cself.stats.schur_pc_rebuilds,self._cself.stats.schur_pc_reuses) )
+                print( "Schur pc setup time: %.4e (last rebuild)" %(self._cself.stats.schur_pc_setup_time) )
+                print( "Schur pc time saved: %.4e" %(self._cself.stats.schur_pc_time_saved) )
+                print( " " )
             print( "Velocity solution min/max: %.4e/%.4e" % (self._cself.stats.vmin,self._cself.stats.vmax) )
             print( "Pressure solution min/max: %.4e/%.4e" % (self._cself.stats.pmin,self._cself.stats.pmax) )
             print( " " )
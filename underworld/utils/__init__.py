@@ -19,6 +19,7 @@ from ._utils import _createMeshName, _spacetimeschema, _fieldschema, _swarmspace
 from ._utils import is_kernel
 from ._meshvariable_projection import MeshVariable_Projection, SolveLinearSystem
 from . import _io
+from ._io import AsyncWriter
 
 def _run_from_ipython():
     """
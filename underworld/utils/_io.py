@@ -18,14 +18,22 @@ required behaviour:
 2 - collective
 
 You may alternatively set the `PATTERN` module variable directly.
+
+Files written natively (directly from the underlying C arrays using MPI-IO,
+see the `native` option to the `save()` methods) align their datasets within
+the file to `ALIGNMENT` bytes, which should usually be set to the filesystem
+stripe size. It defaults to 1MB, and may be set using the `UW_IO_ALIGNMENT`
+environment variable or the module variable directly.
 """
 
 
 import underworld as uw
 import h5py
+import numpy as np
 from mpi4py import MPI
 import os
 PATTERN = int(os.getenv('UW_IO_PATTERN', 0))
+ALIGNMENT = int(os.getenv('UW_IO_ALIGNMENT', 1024*1024))
 
 class h5File(uw.mpi.call_pattern):
     """
@@ -188,3 +196,254 @@ def h5_get_dataset(h5f, name):
     if not hasattr(dset, "collective") or (h5f.driver!="mpio"):
         dset.__class__ = _PatchedDataset
     return dset
+
+def h5_create_contiguous(filename, datasets, attrs=None, links=None, comm=None, alignment=None):
+    """
+    This function creates a new file on the root process, with the storage for
+    each dataset allocated contiguously up front so that values may be written
+    directly to the file using MPI-IO. The byte offset of each dataset within
+    the file is returned on all processes (or None for empty datasets).
+
+    Parameters
+    ----------
+    filename: str
+        The filename for the new file.
+    datasets: list
+        A list of `(name, globalShape, dtype)` tuples.
+    attrs: dict
+        File attributes.
+    links: dict
+        Links (eg. `h5py.ExternalLink`) to add to the file, keyed by name.
+    comm: mpi4py.MPI.Comm
+        The communicator of the processes writing the file. Defaults to
+        `underworld.mpi.comm`.
+    alignment: int
+        If provided, datasets of at least this many bytes are aligned to
+        this many bytes within the file.
+
+    Notes
+    -----
+    This function must be called collectively by all processes in `comm`.
+    """
+    comm = comm or uw.mpi.comm
+    offsets = None
+    error = None
+    if comm.rank == 0:
+        try:
+            offsets = []
+            fapl = h5py.h5p.create(h5py.h5p.FILE_ACCESS)
+            if alignment:
+                # only objects of at least the alignment size (ie. the larger datasets) are aligned
+                fapl.set_alignment(int(alignment), int(alignment))
+            fid = h5py.h5f.create(filename.encode(), h5py.h5f.ACC_TRUNC, fapl=fapl)
+            with h5py.File(fid) as h5f:
+                for key, val in (attrs or {}).items():
+                    h5f.attrs[key] = val
+                for name, globalShape, dtype in datasets:
+                    dcpl = h5py.h5p.create(h5py.h5p.DATASET_CREATE)
+                    dcpl.set_alloc_time(h5py.h5d.ALLOC_TIME_EARLY)
+                    dcpl.set_fill_time(h5py.h5d.FILL_TIME_NEVER)
+                    space = h5py.h5s.create_simple(tuple(globalShape))
+                    dset  = h5py.h5d.create(h5f.id, name.encode(), h5py.h5t.py_create(np.dtype(dtype)), space, dcpl=dcpl)
+                    offsets.append(dset.get_offset())
+                for key, val in (links or {}).items():
+                    h5f[key] = val
+        except Exception as e:
+            error = e
+    error = comm.bcast(error, root=0)
+    if error is not None:
+        raise error
+    return comm.bcast(offsets, root=0)
+
+
+class AsyncWriter(object):
+    """
+    This class allows checkpoint data to be written in the background while the
+    simulation continues. Pass a writer to the `save()` method of meshes, mesh
+    variables, swarms and swarm variables. The data is then copied into staging
+    buffers, the HDF5 file and its datasets are created, and the dataset values
+    are written using non-blocking MPI-IO. The `save()` call returns once the
+    writes are posted, and the values may be modified straight away.
+
+    Saved files must not be read until they have been completed by `wait()`, or
+    by `flush()` once the writes have finished. The staging memory on each
+    process is capped by `maxStagingBytes`. Where a new save would exceed the
+    cap, the oldest pending writes are completed first.
+
+    How much of the write actually overlaps computation depends on the MPI
+    library's support for asynchronous file IO. Where it has none, the writes
+    are completed as they are posted and the writer behaves like a
+    synchronous save.
+
+    Parameters
+    ----------
+    maxStagingBytes: int
+        Maximum bytes of staged data held by each process for pending writes.
+
+    Notes
+    -----
+    All methods must be called collectively by all processes.
+
+    Example
+    -------
+    >>> mesh = uw.mesh.FeMesh_Cartesian( elementType='Q1/dQ0', elementRes=(16,16), minCoord=(0.,0.), maxCoord=(1.,1.) )
+    >>> var = mesh.add_variable(1)
+    >>> var.data[:,0] = mesh.data[:,0]
+    >>> writer = uw.utils.AsyncWriter()
+    >>> meshHandle = mesh.save("async_mesh.h5", writer=writer)
+    >>> ignoreMe = var.save("async_mesh_variable.h5", meshHandle, writer=writer)
+
+    The variable may be modified once saved, and the files are complete once
+    waited on:
+
+    >>> var.data[:] = 0.
+    >>> writer.wait()
+    >>> clone_var = mesh.add_variable(1)
+    >>> clone_var.load("async_mesh_variable.h5")
+    >>> import numpy as np
+    >>> np.allclose(clone_var.data[:,0], mesh.data[:,0])
+    True
+
+    >>> # clean up:
+    >>> if uw.mpi.rank == 0:
+    ...     import os;
+    ...     os.remove( "async_mesh_variable.h5" )
+    ...     os.remove( "async_mesh.h5" )
+
+    """
+    def __init__(self, maxStagingBytes=2**30):
+        self.maxStagingBytes = int(maxStagingBytes)
+        self._comm    = None
+        self._pending = []
+        self._staged  = 0
+
+    @property
+    def stagedBytes(self):
+        """
+        Bytes of staged data held by this process for writes not yet completed.
+        """
+        return self._staged
+
+    @property
+    def pending(self):
+        """
+        Filenames of saves not yet completed.
+        """
+        return [ f["filename"] for f in self._pending ]
+
+    def write(self, filename, datasets, attrs=None, links=None):
+        """
+        Saves the provided datasets to a new HDF5 file, returning once the
+        writes have been posted.
+
+        Parameters
+        ----------
+        filename: str
+            The filename for the saved file.
+        datasets: list
+            A list of `(name, globalShape, data, rows)` tuples. The local `data`
+            array is written to the rows of the global dataset given by `rows`,
+            either an array of global row indices, or the integer offset of
+            the local rows where they are contiguous.
+        attrs: dict
+            File attributes.
+        links: dict
+            Links (eg. `h5py.ExternalLink`) to add to the file, keyed by name.
+        """
+        # writes use their own communicator so they can't interfere with any
+        # other communication in progress, held until the saves are waited on
+        if self._comm is None:
+            self._comm = uw.mpi.comm.Dup()
+
+        # snapshot the local data, ordered by row, and find contiguous runs
+        staged = []
+        nbytes = 0
+        for name, globalShape, data, rows in datasets:
+            data = np.asarray(data)
+            if np.isscalar(rows):
+                buf  = np.array(data, order='C')
+                runs = [ (int(rows), 0, len(buf)) ] if len(buf) else []
+            else:
+                rows  = np.asarray(rows)
+                order = np.argsort(rows, kind='stable')
+                rows  = rows[order]
+                buf   = np.ascontiguousarray(data[order])
+                breaks = np.flatnonzero(np.diff(rows) != 1) + 1
+                starts = np.concatenate(([0], breaks)) if len(rows) else []
+                ends   = np.concatenate((breaks, [len(rows)])) if len(rows) else []
+                runs = [ (int(rows[s]), int(s), int(e)) for s, e in zip(starts, ends) ]
+            staged.append( (name, tuple(globalShape), buf, runs) )
+            nbytes += buf.nbytes
+
+        # an earlier save to the same file must be completed before it is replaced
+        filename = os.path.abspath(filename)
+        for pending in [ f for f in self._pending if f["filename"] == filename ]:
+            self._complete(pending)
+
+        # keep within the staging cap by completing the oldest writes
+        for pending in self._pending:
+            if self._staged + nbytes <= self.maxStagingBytes:
+                break
+            self._complete(pending, close=False)
+
+        # create the file and datasets on the root process, with storage allocated
+        # contiguously so the values may be written directly to the dataset offsets
+        offsets = h5_create_contiguous(filename, [ (name, globalShape, buf.dtype) for name, globalShape, buf, runs in staged ],
+                                       attrs=attrs, links=links, comm=self._comm)
+
+        # post the writes
+        fh = MPI.File.Open(self._comm, filename, MPI.MODE_WRONLY)
+        requests = []
+        for (name, globalShape, buf, runs), offset in zip(staged, offsets):
+            if offset is None:
+                continue
+            rowbytes = buf.itemsize*int(np.prod(globalShape[1:]))
+            view = buf.reshape(-1).view(np.uint8)
+            for row, start, end in runs:
+                requests.append( fh.Iwrite_at(offset + row*rowbytes, view[start*rowbytes:end*rowbytes]) )
+
+        self._pending.append( { "filename" : filename, "file" : fh, "requests" : requests,
+                                "buffers" : staged, "nbytes" : nbytes } )
+        self._staged += nbytes
+
+    def _complete(self, pending, close=True):
+        # wait for the writes, releasing the staging memory
+        if pending["requests"]:
+            MPI.Request.Waitall(pending["requests"])
+            pending["requests"] = []
+        if pending["buffers"]:
+            pending["buffers"] = None
+            self._staged -= pending["nbytes"]
+        if close:
+            pending["file"].Close()
+            self._pending.remove(pending)
+
+    def flush(self):
+        """
+        Completes any saves whose writes have finished on all processes,
+        without waiting for those still in progress.
+        """
+        if not self._pending:
+            return
+        done = np.array([ MPI.Request.Testall(f["requests"]) if f["requests"] else True for f in self._pending ], dtype='i')
+        self._comm.Allreduce(MPI.IN_PLACE, done, op=MPI.MIN)
+        for pending, isdone in list(zip(self._pending, done)):
+            if isdone:
+                self._complete(pending)
+
+    def wait(self):
+        """
+        Completes all pending saves.
+        """
+        while self._pending:
+            self._complete(self._pending[0])
+        # files are closed, so the communicator is no longer required
+        if self._comm is not None:
+            self._comm.Free()
+            self._comm = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.wait()
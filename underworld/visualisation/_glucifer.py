@@ -73,6 +73,11 @@ class Store(_stgermain.StgCompoundComponent):
         Set to true and pass filename if loading a saved database for re-visualisation
     compress: bool
         Set to true to enable database compression.
+    partitions: int
+        Number of geometry partitions to write in parallel. Each partition gathers geometry
+        to its own root process, which writes a separate database that is then attached and
+        copied into the store. Bounds the memory required on the root process for large runs.
+        Requires a filename, default is to gather all geometry to the root process.
 
     Example
     -------
@@ -112,7 +117,7 @@ class Store(_stgermain.StgCompoundComponent):
     _selfObjectName = "_db"
     viewer = None
 
-    def __init__(self, filename=None, split=False, compress=True, **kwargs):
+    def __init__(self, filename=None, split=False, compress=True, partitions=0, **kwargs):
 
         self.step = 0
         if filename is None:
@@ -125,6 +130,7 @@ class Store(_stgermain.StgCompoundComponent):
         if not self.filename: split = False
         self._split = split
         self.compress = compress
+        self.partitions = partitions
         super(Store,self).__init__(**kwargs)
 
     def _add_to_stg_dict(self,componentDictionary):
@@ -144,9 +150,10 @@ class Store(_stgermain.StgCompoundComponent):
 
         componentDictionary[self._db.name].update( {
                             "filename"          :filename,
-                            "splitTransactions" :True,
+                            "splitTransactions" :False,
                             "singleFile"        :not self._split,
                             "compressed"        :self.compress,
+                            "partitions"        :self.partitions,
         } )
 
     def save(self,filename):
@@ -229,11 +236,19 @@ class Store(_stgermain.StgCompoundComponent):
             #Add the object to the drawing object register for the database
             libUnderworld.StGermain.Stg_ObjectList_Append(self._db.drawingObjects.objects,obj._cself)
 
-        # go ahead and fill db
-        libUnderworld.gLucifer._lucDatabase_Execute(self._db,None)
+        try:
+            # go ahead and fill db
+            libUnderworld.gLucifer._lucDatabase_Execute(self._db,None)
+
+            #Write visualisation state as json data
+            libUnderworld.gLucifer.lucDatabase_WriteState(self._db, figname, self._get_state(self._objects, props))
+        except:
+            #Discard the partial timestep so the transaction is not left open for the next output
+            libUnderworld.gLucifer.lucDatabase_Rollback(self._db)
+            raise
 
-        #Write visualisation state as json data
-        libUnderworld.gLucifer.lucDatabase_WriteState(self._db, figname, self._get_state(self._objects, props))
+        #Commit the timestep, all output is written in a single transaction
+        libUnderworld.gLucifer.lucDatabase_Dump(self._db)
 
         #Output any custom geometry on objects
         if lavavu and uw.mpi.rank == 0 and any(x.geomType is not None for x in self._objects):